@@ -0,0 +1,202 @@
+#define FIBO_HEAP_BUILD
+
+#include <limits>
+#include <new>
+#include <vector>
+#include "fibonacci_heap_c.h"
+#include "../source/fibonacci_heap.hpp"
+
+using node_base = algo::ds::fibo::node_impl::FiboNode<double>;
+
+struct fibo_node : public node_base {
+    uint64_t payload;
+
+    fibo_node(double key, uint64_t p) : node_base(key), payload{ p } {};
+};
+
+/**
+ * Elements are fibo_node objects owned by the wrapper and linked with insertNode, so they never go through the
+ * heap's own allocator and are always released here.
+ */
+struct fibo_heap {
+    algo::ds::fibo::FibonacciHeap<double> heap;
+};
+
+namespace {
+
+    fibo_node* pop_(fibo_heap* h) {
+        return static_cast<fibo_node*>(h->heap.extractMinimumNode());
+    }
+
+    /**
+     * Runs f and turns any exception into `failed`, so that none unwinds through the extern "C" functions.
+     */
+    template <typename R, typename F>
+    R guard_(R failed, F&& f) noexcept {
+        try {
+            return f();
+        }
+        catch (...) {
+            return failed;
+        }
+    }
+
+    template <typename F>
+    void guard_(F&& f) noexcept {
+        try {
+            f();
+        }
+        catch (...) {
+        }
+    }
+
+}
+
+extern "C" {
+
+uint32_t fibo_heap_abi_version(void) {
+    return FIBO_HEAP_ABI_VERSION;
+}
+
+fibo_heap* fibo_heap_create(void) {
+    return guard_<fibo_heap*>(nullptr, [] { return new (std::nothrow) fibo_heap; });
+}
+
+void fibo_heap_destroy(fibo_heap* heap) {
+    if (heap == nullptr) return;
+
+    fibo_heap_clear(heap);
+    delete heap;
+}
+
+fibo_handle fibo_heap_insert(fibo_heap* heap, double key, uint64_t payload) {
+    auto* n = new (std::nothrow) fibo_node(key, payload);
+
+    if (n == nullptr) return nullptr;
+
+    return guard_<fibo_handle>(nullptr, [&] { heap->heap.insertNode(n); return n; });
+}
+
+size_t fibo_heap_insert_many(fibo_heap* heap, const double* keys, const uint64_t* payloads, size_t count, fibo_handle* out) {
+    for (size_t i = 0; i < count; ++i) {
+        auto* n = fibo_heap_insert(heap, keys[i], payloads ? payloads[i] : 0);
+
+        if (n == nullptr) return i;
+        if (out) out[i] = n;
+    }
+
+    return count;
+}
+
+int fibo_heap_peek(const fibo_heap* heap, double* key, uint64_t* payload) {
+    if (heap->heap.isEmpty()) return 0;
+
+    auto* n = static_cast<fibo_node*>(heap->heap.getRoot());
+
+    if (key) *key = n->value;
+    if (payload) *payload = n->payload;
+
+    return 1;
+}
+
+fibo_handle fibo_heap_root(const fibo_heap* heap) {
+    return static_cast<fibo_node*>(heap->heap.getRoot());
+}
+
+int fibo_heap_pop(fibo_heap* heap, double* key, uint64_t* payload) {
+    if (heap->heap.isEmpty()) return 0;
+
+    auto* n = guard_<fibo_node*>(nullptr, [&] { return pop_(heap); });
+
+    if (n == nullptr) return -1;
+    if (key) *key = n->value;
+    if (payload) *payload = n->payload;
+
+    delete n;
+
+    return 1;
+}
+
+size_t fibo_heap_pop_many(fibo_heap* heap, double* keys, uint64_t* payloads, size_t count) {
+    size_t i = 0;
+
+    for (; i < count && !heap->heap.isEmpty(); ++i) {
+        if (fibo_heap_pop(heap, keys ? keys + i : nullptr, payloads ? payloads + i : nullptr) < 0) break;
+    }
+
+    return i;
+}
+
+int fibo_heap_decrease_key(fibo_heap* heap, fibo_handle node, double key) {
+    if (node->value < key) return 0;
+
+    return guard_(-1, [&] { heap->heap.decreaseKey(node, key); return 1; });
+}
+
+void fibo_heap_erase(fibo_heap* heap, fibo_handle node) {
+    guard_([&] {
+        heap->heap.extractNode(node);
+        delete node;
+    });
+}
+
+fibo_handle fibo_heap_find(fibo_heap* heap, double key) {
+    return guard_<fibo_handle>(nullptr, [&] { return static_cast<fibo_node*>(heap->heap.find(key)); });
+}
+
+void fibo_heap_merge(fibo_heap* into, fibo_heap* from) {
+    guard_([&] { into->heap.merge(from->heap); });
+}
+
+void fibo_heap_clear(fibo_heap* heap) {
+    guard_([&] {
+        while (!heap->heap.isEmpty()) delete pop_(heap);
+    });
+}
+
+size_t fibo_heap_size(const fibo_heap* heap) {
+    return heap->heap.size();
+}
+
+double fibo_heap_max(fibo_heap* heap) {
+    if (heap->heap.isEmpty()) return 0.0;
+
+    return guard_(std::numeric_limits<double>::quiet_NaN(), [&] { return heap->heap.getMaximum(); });
+}
+
+size_t fibo_heap_keys(const fibo_heap* heap, double* keys, size_t capacity) {
+    std::vector<node_base*> rings;
+    size_t                  copied = 0;
+
+    guard_([&] {
+        if (!heap->heap.isEmpty()) rings.push_back(heap->heap.getRoot());
+
+        while (!rings.empty() && copied < capacity) {
+            auto* first = rings.back();
+            rings.pop_back();
+            auto* n = first;
+
+            do {
+                if (copied == capacity) break;
+
+                keys[copied++] = n->value;
+
+                if (n->child) rings.push_back(n->child);
+
+                n = n->next;
+            } while (n != first);
+        }
+    });
+
+    return copied;
+}
+
+double fibo_handle_key(fibo_handle node) {
+    return node->value;
+}
+
+uint64_t fibo_handle_payload(fibo_handle node) {
+    return node->payload;
+}
+
+}
@@ -0,0 +1,86 @@
+#ifndef FIBONACCIHEAP_FIBONACCI_HEAP_C_H
+#define FIBONACCIHEAP_FIBONACCI_HEAP_C_H
+
+#pragma once
+
+/*
+ * Stable C ABI around FibonacciHeap<double> for bindings (see Python_implementation/native_fibonacci_heap.py).
+ *
+ * Every element is a double key with an opaque 64-bit payload. fibo_heap_insert() returns a handle that stays valid
+ * until the element leaves the heap (pop, erase, clear or destroy); handles of other heaps must not be mixed in.
+ * No C++ exception crosses this interface: every entry point catches them and reports the failure through its return
+ * value (NULL, a short count, -1 or NaN as documented below) with the heap left valid. Removals do not fail on
+ * allocation failure, they leave the remaining roots unconsolidated instead.
+ *
+ * The per-call overhead of a binding (about a microsecond through ctypes) outweighs a single insert or pop, so
+ * fibo_heap_insert_many() and fibo_heap_pop_many() are the intended fast path; element-at-a-time calls from Python are
+ * no faster than a pure-Python heap.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(_WIN32)
+#  if defined(FIBO_HEAP_BUILD)
+#    define FIBO_HEAP_API __declspec(dllexport)
+#  else
+#    define FIBO_HEAP_API __declspec(dllimport)
+#  endif
+#else
+#  define FIBO_HEAP_API __attribute__((visibility("default")))
+#endif
+
+#define FIBO_HEAP_ABI_VERSION 1
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct fibo_heap fibo_heap;
+typedef struct fibo_node* fibo_handle;
+
+FIBO_HEAP_API uint32_t    fibo_heap_abi_version(void);
+
+/* NULL if the heap cannot be allocated. */
+FIBO_HEAP_API fibo_heap*  fibo_heap_create(void);
+FIBO_HEAP_API void        fibo_heap_destroy(fibo_heap* heap);
+
+/* NULL if the element cannot be allocated. */
+FIBO_HEAP_API fibo_handle fibo_heap_insert(fibo_heap* heap, double key, uint64_t payload);
+/* Inserts count elements (payloads may be NULL for zero payloads), stores their handles in out if it is not NULL and
+ * returns the number inserted, less than count only if an allocation failed. */
+FIBO_HEAP_API size_t      fibo_heap_insert_many(fibo_heap* heap, const double* keys, const uint64_t* payloads, size_t count, fibo_handle* out);
+
+/* The pop and peek functions return 0 on an empty heap, 1 otherwise (pop -1 on an internal error); key and payload
+ * may be NULL. */
+FIBO_HEAP_API int         fibo_heap_peek(const fibo_heap* heap, double* key, uint64_t* payload);
+FIBO_HEAP_API int         fibo_heap_pop(fibo_heap* heap, double* key, uint64_t* payload);
+/* Handle of the minimum, NULL on an empty heap. */
+FIBO_HEAP_API fibo_handle fibo_heap_root(const fibo_heap* heap);
+/* Pops up to count minima in ascending order, returns the number popped (fewer only on an empty heap or an error). */
+FIBO_HEAP_API size_t      fibo_heap_pop_many(fibo_heap* heap, double* keys, uint64_t* payloads, size_t count);
+
+/* Returns 0 and leaves the element unchanged if key is larger than its current key, -1 on an internal error. */
+FIBO_HEAP_API int         fibo_heap_decrease_key(fibo_heap* heap, fibo_handle node, double key);
+FIBO_HEAP_API void        fibo_heap_erase(fibo_heap* heap, fibo_handle node);
+/* Handle of an element with the given key, NULL if there is none or on an internal error. Linear time. */
+FIBO_HEAP_API fibo_handle fibo_heap_find(fibo_heap* heap, double key);
+/* Moves every element of from into into, handles stay valid and now belong to into. */
+FIBO_HEAP_API void        fibo_heap_merge(fibo_heap* into, fibo_heap* from);
+FIBO_HEAP_API void        fibo_heap_clear(fibo_heap* heap);
+
+FIBO_HEAP_API size_t      fibo_heap_size(const fibo_heap* heap);
+/* Largest key, 0 on an empty heap, NaN if it had to be recomputed and that failed. */
+FIBO_HEAP_API double      fibo_heap_max(fibo_heap* heap);
+/* Copies up to capacity keys in no particular order and returns the number copied, fewer than available only if the
+ * traversal could not allocate. */
+FIBO_HEAP_API size_t      fibo_heap_keys(const fibo_heap* heap, double* keys, size_t capacity);
+
+FIBO_HEAP_API double      fibo_handle_key(fibo_handle node);
+FIBO_HEAP_API uint64_t    fibo_handle_payload(fibo_handle node);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
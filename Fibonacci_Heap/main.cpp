@@ -4,6 +4,24 @@ int main() {
     std::cout << "Hello, World!" << std::endl;
 
     example();
+    asyncQueueExample();
+    timerSchedulerExample();
+    threadPoolExample();
+    allocatorExample();
+    hugePageArenaExample();
+    consolidationExample();
+    bulkBuildExample();
+    parallelConsolidationExample();
+    meldExample();
+    batchedDecreaseKeyExample();
+    doubleEndedExample();
+    externalHeapExample();
+    staticHeapExample();
+    dumpExample();
+    persistentHeapExample();
+    keyPackerExample();
+    compactionExample();
+    concurrentReadersExample();
 
     return 0;
 }
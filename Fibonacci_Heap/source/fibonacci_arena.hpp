@@ -0,0 +1,220 @@
+#ifndef FIBONACCIHEAP_FIBONACCI_ARENA_HPP
+#define FIBONACCIHEAP_FIBONACCI_ARENA_HPP
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <new>
+#include <vector>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace algo::ds::fibo::memory {
+
+    struct ArenaOptions {
+        size_t regionSize      = size_t(64) << 20;
+        bool   useHugePages    = true;
+        bool   explicitHugeTlb = false;
+        bool   bindToLocalNode = true;
+    };
+
+    /**
+     * Memory resource for heap nodes: large regions carved by a bump pointer, with per-size free lists so freed nodes
+     * are reused. On Linux regions are 2 MB aligned and backed by huge pages (MAP_HUGETLB when explicitHugeTlb is set
+     * and hugetlbfs pages are reserved, otherwise madvise(MADV_HUGEPAGE)), and are bound to the NUMA node of the
+     * thread that creates the resource with mbind(MPOL_PREFERRED). Every step falls back silently: without huge pages
+     * or NUMA support the arena still works as a plain pool. Elsewhere regions come from the upstream resource.
+     *
+     * Not thread safe, like std::pmr::unsynchronized_pool_resource.
+     */
+    class HugePageArenaResource : public std::pmr::memory_resource {
+    public:
+        static constexpr size_t hugePageSize = size_t(2) << 20;
+
+    protected:
+        struct Region {
+            void*  base;
+            size_t size;
+            bool   mapped;
+        };
+
+        struct FreeBlock {
+            FreeBlock* next;
+        };
+
+        static constexpr size_t granularity = 16;
+        static constexpr size_t numClasses = 32;
+
+        ArenaOptions                options;
+        std::pmr::memory_resource*  upstream;
+        std::vector<Region>         regions;
+        FreeBlock*                  freeLists[numClasses] = { nullptr };
+        std::byte*                  cursor = nullptr;
+        std::byte*                  limit = nullptr;
+        int                         numaNode = -1;
+        size_t                      hugeTlbRegions = 0;
+        size_t                      advisedRegions = 0;
+
+    public:
+        explicit HugePageArenaResource(ArenaOptions o = ArenaOptions(), std::pmr::memory_resource* up = std::pmr::new_delete_resource())
+            : options{ o }, upstream{ up } { if (options.bindToLocalNode) numaNode = currentNumaNode_(); };
+        HugePageArenaResource(const HugePageArenaResource&) = delete;
+        HugePageArenaResource& operator= (const HugePageArenaResource&) = delete;
+        ~HugePageArenaResource() override { release(); };
+
+        void                 release();
+        [[nodiscard]] int    boundNumaNode()  const { return numaNode; };
+        [[nodiscard]] size_t hugeTlbBacked()  const { return hugeTlbRegions; };
+        [[nodiscard]] size_t hugePageAdvised() const { return advisedRegions; };
+        [[nodiscard]] size_t regionCount()    const { return regions.size(); };
+
+    protected:
+        void* do_allocate(size_t bytes, size_t alignment) override;
+        void  do_deallocate(void* p, size_t bytes, size_t alignment) override;
+        bool  do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; };
+
+    private:
+        static size_t sizeClass_(size_t bytes, size_t alignment);
+        static int    currentNumaNode_();
+        void          grow_(size_t minBytes);
+        Region        mapRegion_(size_t bytes);
+        void          bindToNode_(void* p, size_t bytes) const;
+    };
+
+    inline void HugePageArenaResource::release() {
+        for (auto& r : regions) {
+#if defined(__linux__)
+            if (r.mapped) {
+                munmap(r.base, r.size);
+                continue;
+            }
+#endif
+            upstream->deallocate(r.base, r.size, hugePageSize);
+        }
+
+        regions.clear();
+        cursor = limit = nullptr;
+
+        for (auto& f : freeLists) f = nullptr;
+    }
+
+    inline void* HugePageArenaResource::do_allocate(size_t bytes, size_t alignment) {
+        size_t cls = sizeClass_(bytes, alignment);
+
+        if (cls < numClasses && freeLists[cls]) {
+            auto* b = freeLists[cls];
+            freeLists[cls] = b->next;
+
+            return b;
+        }
+
+        size_t size = (cls < numClasses) ? (cls + 1) * granularity : bytes;
+        auto   addr = reinterpret_cast<std::uintptr_t>(cursor);
+        auto   aligned = (addr + alignment - 1) & ~(std::uintptr_t(alignment) - 1);
+
+        if (cursor == nullptr || aligned + size > reinterpret_cast<std::uintptr_t>(limit)) {
+            grow_(size + alignment);
+            addr = reinterpret_cast<std::uintptr_t>(cursor);
+            aligned = (addr + alignment - 1) & ~(std::uintptr_t(alignment) - 1);
+        }
+
+        cursor = reinterpret_cast<std::byte*>(aligned + size);
+
+        return reinterpret_cast<void*>(aligned);
+    }
+
+    inline void HugePageArenaResource::do_deallocate(void* p, size_t bytes, size_t alignment) {
+        size_t cls = sizeClass_(bytes, alignment);
+
+        if (cls >= numClasses) return;
+
+        auto* b = static_cast<FreeBlock*>(p);
+        b->next = freeLists[cls];
+        freeLists[cls] = b;
+    }
+
+    inline size_t HugePageArenaResource::sizeClass_(size_t bytes, size_t alignment) {
+        if (alignment > granularity || bytes == 0) return numClasses;
+
+        return (bytes - 1) / granularity;
+    }
+
+    inline int HugePageArenaResource::currentNumaNode_() {
+#if defined(__linux__) && defined(SYS_getcpu)
+        unsigned cpu = 0, node = 0;
+
+        if (syscall(SYS_getcpu, &cpu, &node, nullptr) == 0) return static_cast<int>(node);
+#endif
+        return -1;
+    }
+
+    inline void HugePageArenaResource::grow_(size_t minBytes) {
+        size_t bytes = options.regionSize > minBytes ? options.regionSize : minBytes;
+        bytes = (bytes + hugePageSize - 1) & ~(hugePageSize - 1);
+
+        auto r = mapRegion_(bytes);
+        regions.push_back(r);
+        cursor = static_cast<std::byte*>(r.base);
+        limit = cursor + r.size;
+    }
+
+    inline HugePageArenaResource::Region HugePageArenaResource::mapRegion_(size_t bytes) {
+#if defined(__linux__)
+#if defined(MAP_HUGETLB)
+        if (options.useHugePages && options.explicitHugeTlb) {
+            void* p = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+
+            if (p != MAP_FAILED) {
+                hugeTlbRegions++;
+                bindToNode_(p, bytes);
+
+                return Region{ p, bytes, true };
+            }
+        }
+#endif
+        // Over-allocate by one huge page and trim, so the region starts on a 2 MB boundary.
+        void* raw = mmap(nullptr, bytes + hugePageSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+        if (raw != MAP_FAILED) {
+            auto start = reinterpret_cast<std::uintptr_t>(raw);
+            auto aligned = (start + hugePageSize - 1) & ~(std::uintptr_t(hugePageSize) - 1);
+            size_t tail = start + hugePageSize - aligned;
+
+            if (aligned > start) munmap(raw, aligned - start);
+            if (tail > 0) munmap(reinterpret_cast<void*>(aligned + bytes), tail);
+
+            void* p = reinterpret_cast<void*>(aligned);
+#if defined(MADV_HUGEPAGE)
+            if (options.useHugePages && madvise(p, bytes, MADV_HUGEPAGE) == 0) advisedRegions++;
+#endif
+            bindToNode_(p, bytes);
+
+            return Region{ p, bytes, true };
+        }
+#endif
+
+        return Region{ upstream->allocate(bytes, hugePageSize), bytes, false };
+    }
+
+    inline void HugePageArenaResource::bindToNode_(void* p, size_t bytes) const {
+#if defined(__linux__) && defined(SYS_mbind)
+        if (numaNode < 0 || numaNode >= static_cast<int>(sizeof(unsigned long) * 8)) return;
+
+        unsigned long mask = 1UL << numaNode;
+        // MPOL_PREFERRED, so a full node spills over instead of failing the page fault. maxnode counts one extra bit.
+        syscall(SYS_mbind, p, bytes, 1, &mask, sizeof(mask) * 8 + 1, 0);
+#else
+        (void)p;
+        (void)bytes;
+#endif
+    }
+
+}
+
+#endif
@@ -0,0 +1,260 @@
+#ifndef FIBONACCIHEAP_FIBONACCI_ASYNC_QUEUE_HPP
+#define FIBONACCIHEAP_FIBONACCI_ASYNC_QUEUE_HPP
+
+#pragma once
+
+#include <algorithm>
+#include <coroutine>
+#include <deque>
+#include <exception>
+#include <utility>
+#include "fibonacci_heap.hpp"
+
+namespace algo::ds::fibo::async {
+
+    /**
+     * Fire-and-forget coroutine type. The coroutine is created suspended and starts running once it is handed to an
+     * executor with spawn(); its frame is destroyed when it finishes.
+     */
+    class Task {
+    public:
+        struct promise_type {
+            Task                get_return_object() { return Task{ std::coroutine_handle<promise_type>::from_promise(*this) }; };
+            std::suspend_always initial_suspend()   noexcept { return {}; };
+            std::suspend_never  final_suspend()     noexcept { return {}; };
+            void                return_void()       {};
+            void                unhandled_exception() { std::terminate(); };
+        };
+
+    protected:
+        std::coroutine_handle<promise_type> handle;
+
+    public:
+        Task() : handle{ nullptr } {};
+        explicit Task(std::coroutine_handle<promise_type> h) : handle{ h } {};
+        Task(const Task&) = delete;
+        Task(Task&& s) noexcept : handle{ std::exchange(s.handle, nullptr) } {};
+        ~Task() { if (handle) handle.destroy(); };
+
+        Task& operator= (const Task&) = delete;
+        Task& operator= (Task&& o) noexcept { if (this != &o) { if (handle) handle.destroy(); handle = std::exchange(o.handle, nullptr); } return *this; };
+
+        std::coroutine_handle<> release() { return std::exchange(handle, nullptr); };
+    };
+
+    /**
+     * Minimal single-threaded executor: a FIFO of ready coroutines drained by run(). Scheduling is a plain deque push,
+     * so waking a coroutine never needs a syscall. Intended for event loops and for testing coroutine code.
+     */
+    class SingleThreadedExecutor {
+    protected:
+        std::deque<std::coroutine_handle<>> ready;
+
+    public:
+        struct YieldAwaiter {
+            SingleThreadedExecutor& executor;
+
+            [[nodiscard]] bool await_ready() const noexcept { return false; };
+            void               await_suspend(std::coroutine_handle<> h) { executor.schedule(h); };
+            void               await_resume() const noexcept {};
+        };
+
+        SingleThreadedExecutor() = default;
+        SingleThreadedExecutor(const SingleThreadedExecutor&) = delete;
+        SingleThreadedExecutor& operator= (const SingleThreadedExecutor&) = delete;
+
+        void                 schedule(std::coroutine_handle<> h) { ready.push_back(h); };
+        bool                 unschedule(std::coroutine_handle<> h);
+        void                 spawn(Task t) { schedule(t.release()); };
+        YieldAwaiter         yield() { return YieldAwaiter{ *this }; };
+        bool                 runOne();
+        size_t               run();
+        [[nodiscard]] bool   isIdle() const { return ready.empty(); };
+    };
+
+    inline bool SingleThreadedExecutor::runOne() {
+        if (ready.empty()) return false;
+
+        auto h = ready.front();
+        ready.pop_front();
+        h.resume();
+
+        return true;
+    }
+
+    /**
+     * Drops a scheduled coroutine that will not be resumed after all, e.g. because its frame is being destroyed.
+     */
+    inline bool SingleThreadedExecutor::unschedule(std::coroutine_handle<> h) {
+        auto it = std::find(ready.begin(), ready.end(), h);
+
+        if (it == ready.end()) return false;
+
+        ready.erase(it);
+
+        return true;
+    }
+
+    inline size_t SingleThreadedExecutor::run() {
+        size_t resumed = 0;
+
+        while (runOne()) resumed++;
+
+        return resumed;
+    }
+
+    /**
+     * Priority queue whose consumers suspend in `co_await queue.pop()` until an element is available. Waiters are
+     * queued in FIFO order and each resumed waiter receives the current minimum, so elements are always handed out in
+     * priority order. push() wakes at most one waiter by scheduling it on the executor.
+     *
+     * The queue is not thread safe: push() and pop() must be called from coroutines (or code) running on the owning
+     * executor's thread. Destroying a coroutine suspended in pop() is safe: its awaiter leaves the waiter list, and if
+     * it had already been woken, its element is handed to the next waiter.
+     */
+    template <typename T>
+    class AsyncFibonacciQueue {
+    public:
+        class PopAwaiter {
+        private:
+            friend class AsyncFibonacciQueue<T>;
+
+            AsyncFibonacciQueue<T>* queue;
+            PopAwaiter*             next = nullptr;
+            std::coroutine_handle<> waiter;
+            bool                    queued = false;
+            bool                    woken = false;
+
+        public:
+            explicit PopAwaiter(AsyncFibonacciQueue<T>* q) : queue{ q } {};
+            PopAwaiter(const PopAwaiter&) = delete;
+            PopAwaiter& operator= (const PopAwaiter&) = delete;
+            ~PopAwaiter();
+
+            [[nodiscard]] bool await_ready() const { return queue->heap.size() > queue->pendingWakeups; };
+            void               await_suspend(std::coroutine_handle<> h) { waiter = h; queue->enqueueWaiter_(this); };
+            T                  await_resume();
+        };
+
+    protected:
+        algo::ds::fibo::FibonacciHeap<T> heap;
+        SingleThreadedExecutor&          executor;
+        PopAwaiter*                      waitersHead = nullptr;
+        PopAwaiter*                      waitersTail = nullptr;
+        size_t                           numWaiters = 0;
+        size_t                           pendingWakeups = 0;
+
+    public:
+        explicit AsyncFibonacciQueue(SingleThreadedExecutor& e) : executor{ e } {};
+        AsyncFibonacciQueue(const AsyncFibonacciQueue&) = delete;
+        AsyncFibonacciQueue& operator= (const AsyncFibonacciQueue&) = delete;
+
+        void                 push(T value);
+        PopAwaiter           pop() { return PopAwaiter{ this }; };
+        bool                 tryPop(T& out);
+        [[nodiscard]] bool   isEmpty() const { return heap.size() <= pendingWakeups; };
+        [[nodiscard]] size_t size()    const { return heap.size() - pendingWakeups; };
+        [[nodiscard]] size_t waiting() const { return numWaiters; };
+
+    private:
+        void        enqueueWaiter_(PopAwaiter*);
+        PopAwaiter* dequeueWaiter_();
+        void        removeWaiter_(PopAwaiter*);
+        void        wakeOne_();
+    };
+
+    template<typename T>
+    inline T AsyncFibonacciQueue<T>::PopAwaiter::await_resume() {
+        if (woken) {
+            woken = false;
+            queue->pendingWakeups--;
+        }
+
+        return queue->heap.removeMinimum();
+    }
+
+    /**
+     * Only runs with work left to undo when the awaiting coroutine is destroyed while suspended.
+     */
+    template<typename T>
+    inline AsyncFibonacciQueue<T>::PopAwaiter::~PopAwaiter() {
+        if (queued) queue->removeWaiter_(this);
+        else if (woken) {
+            queue->executor.unschedule(waiter);
+            queue->pendingWakeups--;
+            queue->wakeOne_();
+        }
+    }
+
+    template<typename T>
+    inline void AsyncFibonacciQueue<T>::push(T value) {
+        heap.insert(value);
+        wakeOne_();
+    }
+
+    template<typename T>
+    inline void AsyncFibonacciQueue<T>::wakeOne_() {
+        if (heap.size() <= pendingWakeups) return;
+
+        auto* w = dequeueWaiter_();
+
+        if (w) {
+            w->woken = true;
+            pendingWakeups++;
+            executor.schedule(w->waiter);
+        }
+    }
+
+    template<typename T>
+    inline bool AsyncFibonacciQueue<T>::tryPop(T& out) {
+        if (isEmpty()) return false;
+
+        out = heap.removeMinimum();
+
+        return true;
+    }
+
+    template<typename T>
+    inline void AsyncFibonacciQueue<T>::enqueueWaiter_(PopAwaiter* w) {
+        if (waitersTail) waitersTail->next = w;
+        else waitersHead = w;
+
+        waitersTail = w;
+        w->queued = true;
+        numWaiters++;
+    }
+
+    template<typename T>
+    inline typename AsyncFibonacciQueue<T>::PopAwaiter* AsyncFibonacciQueue<T>::dequeueWaiter_() {
+        auto* w = waitersHead;
+
+        if (w) {
+            waitersHead = w->next;
+            if (waitersHead == nullptr) waitersTail = nullptr;
+            w->next = nullptr;
+            w->queued = false;
+            numWaiters--;
+        }
+
+        return w;
+    }
+
+    template<typename T>
+    inline void AsyncFibonacciQueue<T>::removeWaiter_(PopAwaiter* w) {
+        PopAwaiter* prev = nullptr;
+
+        for (auto* c = waitersHead; c != w; c = c->next) prev = c;
+
+        if (prev) prev->next = w->next;
+        else waitersHead = w->next;
+
+        if (waitersTail == w) waitersTail = prev;
+
+        w->next = nullptr;
+        w->queued = false;
+        numWaiters--;
+    }
+
+}
+
+#endif
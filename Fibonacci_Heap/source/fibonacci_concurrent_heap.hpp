@@ -0,0 +1,187 @@
+#ifndef FIBONACCIHEAP_FIBONACCI_CONCURRENT_HEAP_HPP
+#define FIBONACCIHEAP_FIBONACCI_CONCURRENT_HEAP_HPP
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <type_traits>
+#include <vector>
+#include "fibonacci_heap.hpp"
+#include "fibonacci_epoch.hpp"
+
+namespace algo::ds::fibo::concurrent {
+
+    /**
+     * Fibonacci heap with one writer thread and any number of lock-free reader threads.
+     *
+     * The minimum and the size are republished after every mutation under a sequence lock, so tryGetMinimum() and
+     * size() never block the writer and always return a (minimum, size) pair that existed. Traversals go through
+     * immutable snapshots instead of the live forest: the writer relinks nodes in place without atomics (every
+     * consolidation rewires next/child pointers), so reading the nodes themselves would race no matter how their
+     * reclamation is deferred. publish() copies the keys into a new snapshot and swaps it in, old snapshots are
+     * reclaimed through an epoch::EpochDomain once no reader holds them. Snapshots cost O(n) and are only built on
+     * publish() or every setAutoPublish() mutations; every other operation costs the writer the plain heap operation
+     * plus the sequence lock update, and a reader polling the published minimum still shares that one cache line.
+     * The constructor publishes an empty snapshot (version 1), so read() always has one to return.
+     *
+     * Writer methods (insert, removeMinimum, decreaseKey, erase, clear, publish) must all be called from one thread.
+     */
+    template <typename T, typename Allocator = std::allocator<T>>
+    class SingleWriterHeap {
+        static_assert(std::is_trivially_copyable_v<T> && std::is_default_constructible_v<T>, "SingleWriterHeap publishes the minimum through std::atomic<T>");
+
+    public:
+        struct Snapshot {
+            std::vector<T> keys;     // keys[0] is the minimum, the rest in no particular order
+            std::uint64_t  version;
+        };
+
+        /**
+         * A pinned snapshot; iterate it like a const container. Keep views short-lived, snapshots retired while a
+         * view is alive cannot be freed.
+         */
+        class ReadView {
+        private:
+            algo::ds::fibo::epoch::EpochDomain::Guard guard;
+            const Snapshot*                           snap;
+
+        public:
+            ReadView(algo::ds::fibo::epoch::EpochDomain::Guard&& g, const Snapshot* s) : guard{ std::move(g) }, snap{ s } {};
+
+            const T*             begin()   const { return snap->keys.data(); };
+            const T*             end()     const { return snap->keys.data() + snap->keys.size(); };
+            [[nodiscard]] size_t size()    const { return snap->keys.size(); };
+            [[nodiscard]] bool   empty()   const { return size() == 0; };
+            std::uint64_t        version() const { return snap->version; };
+        };
+
+    protected:
+        // Everything readers load sits on cache lines of its own, so polling readers do not keep stealing the lines of
+        // the heap and the writer-only counters, which the writer updates on every operation.
+        struct alignas(64) Published {
+            std::atomic<std::uint64_t> seq{ 0 };
+            std::atomic<T>             minValue{};
+            std::atomic<size_t>        count{ 0 };
+            std::atomic<Snapshot*>     current{ nullptr };
+        };
+
+        algo::ds::fibo::FibonacciHeap<T, Allocator>    heap;
+        size_t                                         publishEvery = 0;
+        size_t                                         sincePublish = 0;
+        std::uint64_t                                  versions = 0;
+        Published                                      published;
+        alignas(64) algo::ds::fibo::epoch::EpochDomain domain;
+
+    public:
+        explicit SingleWriterHeap(size_t maxReaders = 64, const Allocator& a = Allocator()) : heap{ a }, domain{ maxReaders } { publish(); };
+        SingleWriterHeap(const SingleWriterHeap&) = delete;
+        SingleWriterHeap& operator= (const SingleWriterHeap&) = delete;
+        ~SingleWriterHeap() { heap.clear(); delete published.current.load(); };
+
+        algo::ds::fibo::node_impl::FiboNode<T>* insert(T value) { auto* n = heap.insert(value); mutated_(); return n; };
+        T                                       removeMinimum() { T ret = heap.removeMinimum(); mutated_(); return ret; };
+        void                                    decreaseKey(algo::ds::fibo::node_impl::FiboNode<T>* n, T value) { heap.decreaseKey(n, value); mutated_(); };
+        void                                    erase(algo::ds::fibo::node_impl::FiboNode<T>*);
+        void                                    clear() { heap.clear(); mutated_(); };
+        void                                    publish();
+        void                                    setAutoPublish(size_t everyMutations) { publishEvery = everyMutations; };
+
+        bool                                    tryGetMinimum(T& out) const;
+        [[nodiscard]] size_t                    size()    const { return published.count.load(std::memory_order_acquire); };
+        [[nodiscard]] bool                      isEmpty() const { return size() == 0; };
+        ReadView                                read()    const;
+
+    private:
+        void                                    mutated_();
+    };
+
+    template<class T, class Allocator>
+    inline void SingleWriterHeap<T, Allocator>::erase(algo::ds::fibo::node_impl::FiboNode<T>* n) {
+        heap.extractNode(n);
+        auto alloc = typename std::allocator_traits<Allocator>::template rebind_alloc<algo::ds::fibo::node_impl::FiboNode<T>>(heap.get_allocator());
+        std::allocator_traits<decltype(alloc)>::destroy(alloc, n);
+        std::allocator_traits<decltype(alloc)>::deallocate(alloc, n, 1);
+        mutated_();
+    }
+
+    /**
+     * Copies the forest into a new snapshot, swaps it in and retires the previous one.
+     */
+    template<class T, class Allocator>
+    inline void SingleWriterHeap<T, Allocator>::publish() {
+        auto* snap = new Snapshot{ {}, ++versions };
+        snap->keys.reserve(heap.size());
+
+        if (auto* root = heap.getRoot()) {
+            std::vector<algo::ds::fibo::node_impl::FiboNode<T>*> stack{ root };
+
+            while (!stack.empty()) {
+                auto* first = stack.back();
+                auto* c = first;
+                stack.pop_back();
+
+                do {
+                    snap->keys.push_back(c->value);
+                    if (c->child) stack.push_back(c->child);
+                    c = c->next;
+                } while (c != first);
+            }
+        }
+
+        if (auto* old = published.current.exchange(snap, std::memory_order_seq_cst)) domain.retire(old);
+
+        domain.collect();
+        sincePublish = 0;
+    }
+
+    /**
+     * Sequence lock read: retried while the writer is between its two counter updates.
+     */
+    template<class T, class Allocator>
+    inline bool SingleWriterHeap<T, Allocator>::tryGetMinimum(T& out) const {
+        for (;;) {
+            std::uint64_t before = published.seq.load(std::memory_order_acquire);
+
+            if (before & 1) {
+                std::this_thread::yield();
+                continue;
+            }
+
+            T      m = published.minValue.load(std::memory_order_relaxed);
+            size_t n = published.count.load(std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_acquire);
+
+            if (published.seq.load(std::memory_order_relaxed) != before) continue;
+            if (n == 0) return false;
+
+            out = m;
+
+            return true;
+        }
+    }
+
+    template<class T, class Allocator>
+    inline typename SingleWriterHeap<T, Allocator>::ReadView SingleWriterHeap<T, Allocator>::read() const {
+        auto guard = domain.pin();
+
+        return ReadView(std::move(guard), published.current.load(std::memory_order_seq_cst));
+    }
+
+    template<class T, class Allocator>
+    inline void SingleWriterHeap<T, Allocator>::mutated_() {
+        std::uint64_t s = published.seq.load(std::memory_order_relaxed);
+        published.seq.store(s + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        published.minValue.store(heap.isEmpty() ? T{} : heap.getMinimum(), std::memory_order_relaxed);
+        published.count.store(heap.size(), std::memory_order_relaxed);
+        published.seq.store(s + 2, std::memory_order_release);
+
+        if (publishEvery && ++sincePublish >= publishEvery) publish();
+    }
+
+}
+
+#endif
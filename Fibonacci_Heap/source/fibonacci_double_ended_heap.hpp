@@ -0,0 +1,166 @@
+#ifndef FIBONACCIHEAP_FIBONACCI_DOUBLE_ENDED_HEAP_HPP
+#define FIBONACCIHEAP_FIBONACCI_DOUBLE_ENDED_HEAP_HPP
+
+#pragma once
+
+#include <memory>
+#include "fibonacci_heap.hpp"
+
+namespace algo::ds::fibo {
+
+    /**
+     * Key wrapper with reversed ordering, a FibonacciHeap<Reversed<T>> is a max-heap of T.
+     */
+    template <typename T>
+    struct Reversed {
+        T value;
+
+        bool operator==(const Reversed& o) const { return value == o.value; };
+        bool operator!=(const Reversed& o) const { return !(value == o.value); };
+        bool operator< (const Reversed& o) const { return o.value < value; };
+        bool operator> (const Reversed& o) const { return value < o.value; };
+        bool operator<=(const Reversed& o) const { return !(value < o.value); };
+        bool operator>=(const Reversed& o) const { return !(o.value < value); };
+    };
+
+    enum class EvictionPolicy {
+        RemoveMaximum,  // keep the `capacity` smallest elements
+        RemoveMinimum   // keep the `capacity` largest elements (streaming top-k)
+    };
+
+    /**
+     * Double-ended priority queue made of two mirrored Fibonacci heaps: every element is one allocation holding its
+     * node in a min-heap and a twin node in a max-heap, so getMinimum() and getMaximum() are O(1) and
+     * removeMinimum()/removeMaximum() are O(log n) amortized (extract from one heap, extractNode the twin).
+     *
+     * With a non-zero capacity the heap is bounded: inserting into a full heap evicts the worst element according to
+     * the eviction policy, or rejects the new element (insert returns nullptr) when it would be the one evicted.
+     */
+    template <typename T, typename Allocator = std::allocator<T>>
+    class DoubleEndedFibonacciHeap {
+    protected:
+        struct Entry;
+
+        struct MaxNode : public algo::ds::fibo::node_impl::FiboNode<Reversed<T>> {
+            Entry* owner;
+
+            MaxNode(const T& v, Entry* o) : algo::ds::fibo::node_impl::FiboNode<Reversed<T>>(Reversed<T>{ v }), owner{ o } {};
+        };
+
+        struct Entry : public algo::ds::fibo::node_impl::FiboNode<T> {
+            MaxNode twin;
+
+            explicit Entry(const T& v) : algo::ds::fibo::node_impl::FiboNode<T>(v), twin{ v, this } {};
+        };
+
+        using entry_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Entry>;
+        using entry_traits    = std::allocator_traits<entry_allocator>;
+
+        algo::ds::fibo::FibonacciHeap<T>           minHeap;
+        algo::ds::fibo::FibonacciHeap<Reversed<T>> maxHeap;
+        size_t                                     maxSize;
+        EvictionPolicy                             policy;
+        entry_allocator                            alloc;
+
+    public:
+        explicit DoubleEndedFibonacciHeap(size_t capacity = 0, EvictionPolicy p = EvictionPolicy::RemoveMaximum, const Allocator& a = Allocator())
+            : maxSize{ capacity }, policy{ p }, alloc{ a } {};
+        DoubleEndedFibonacciHeap(const DoubleEndedFibonacciHeap&) = delete;
+        DoubleEndedFibonacciHeap& operator= (const DoubleEndedFibonacciHeap&) = delete;
+        ~DoubleEndedFibonacciHeap() { clear(); };
+
+        algo::ds::fibo::node_impl::FiboNode<T>* insert(T value);
+        T                                       removeMinimum();
+        T                                       removeMaximum();
+        void                                    erase(algo::ds::fibo::node_impl::FiboNode<T>* n);
+        void                                    decreaseKey(algo::ds::fibo::node_impl::FiboNode<T>* n, T value);
+        const T&                                getMinimum() const { return minHeap.getRoot()->value; };
+        const T&                                getMaximum() const { return maxHeap.getRoot()->value.value; };
+        [[nodiscard]] bool                      isEmpty()    const { return minHeap.isEmpty(); };
+        [[nodiscard]] size_t                    size()       const { return minHeap.size(); };
+        [[nodiscard]] size_t                    capacity()   const { return maxSize; };
+        [[nodiscard]] bool                      isFull()     const { return maxSize != 0 && size() >= maxSize; };
+        void                                    clear() { while (!isEmpty()) removeMinimum(); };
+
+    private:
+        void destroy_(Entry* e);
+    };
+
+    template<class T, class Allocator>
+    inline algo::ds::fibo::node_impl::FiboNode<T>* DoubleEndedFibonacciHeap<T, Allocator>::insert(T value) {
+        if (isFull()) {
+            if (policy == EvictionPolicy::RemoveMaximum) {
+                if (!(value < getMaximum())) return nullptr;
+
+                removeMaximum();
+            }
+            else {
+                if (!(getMinimum() < value)) return nullptr;
+
+                removeMinimum();
+            }
+        }
+
+        auto* e = entry_traits::allocate(alloc, 1);
+        entry_traits::construct(alloc, e, value);
+        minHeap.insertNode(e);
+        maxHeap.insertNode(&e->twin);
+
+        return e;
+    }
+
+    template<class T, class Allocator>
+    inline T DoubleEndedFibonacciHeap<T, Allocator>::removeMinimum() {
+        auto* e = static_cast<Entry*>(minHeap.extractMinimumNode());
+        maxHeap.extractNode(&e->twin);
+
+        T ret = e->value;
+        destroy_(e);
+
+        return ret;
+    }
+
+    template<class T, class Allocator>
+    inline T DoubleEndedFibonacciHeap<T, Allocator>::removeMaximum() {
+        auto* e = static_cast<MaxNode*>(maxHeap.extractMinimumNode())->owner;
+        minHeap.extractNode(e);
+
+        T ret = e->value;
+        destroy_(e);
+
+        return ret;
+    }
+
+    template<class T, class Allocator>
+    inline void DoubleEndedFibonacciHeap<T, Allocator>::erase(algo::ds::fibo::node_impl::FiboNode<T>* n) {
+        auto* e = static_cast<Entry*>(n);
+        minHeap.extractNode(e);
+        maxHeap.extractNode(&e->twin);
+        destroy_(e);
+    }
+
+    /**
+     * O(1) amortized on the min side; on the max side a smaller key moves the twin away from the root, which the heap
+     * cannot do in place, so the twin is extracted and reinserted (O(log n) amortized).
+     */
+    template<class T, class Allocator>
+    inline void DoubleEndedFibonacciHeap<T, Allocator>::decreaseKey(algo::ds::fibo::node_impl::FiboNode<T>* n, T value) {
+        auto* e = static_cast<Entry*>(n);
+
+        if (e->value < value) return;
+
+        minHeap.decreaseKey(e, value);
+        maxHeap.extractNode(&e->twin);
+        e->twin.value = Reversed<T>{ value };
+        maxHeap.insertNode(&e->twin);
+    }
+
+    template<class T, class Allocator>
+    inline void DoubleEndedFibonacciHeap<T, Allocator>::destroy_(Entry* e) {
+        entry_traits::destroy(alloc, e);
+        entry_traits::deallocate(alloc, e, 1);
+    }
+
+}
+
+#endif
@@ -0,0 +1,318 @@
+#ifndef FIBONACCIHEAP_FIBONACCI_DUMP_HPP
+#define FIBONACCIHEAP_FIBONACCI_DUMP_HPP
+
+#pragma once
+
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include "fibonacci_node.hpp"
+
+namespace algo::ds::fibo::io {
+
+    enum class DumpFormat {
+        Text,   // one indented line per node
+        Json,   // {"size":n,"roots":[{"key":k,"degree":d,"marked":b,"children":[...]}, ...]}
+        Dot,    // Graphviz digraph, parent -> child edges, marked nodes filled
+        Binary  // header, then nodes in preorder: key, emitted child count, degree, marked (host byte order)
+    };
+
+    struct DumpOptions {
+        DumpFormat format = DumpFormat::Json;
+        size_t     maxDepth = std::numeric_limits<size_t>::max();  // deepest level written, roots are level 0
+        size_t     maxRoots = std::numeric_limits<size_t>::max();  // only the first k roots, starting at the minimum
+        size_t     bufferSize = size_t(64) << 10;                  // bytes collected before each write to the sink
+    };
+
+    /**
+     * Binary dump header. Keys of trivially copyable types are stored raw (rawKeys = 1, keySize bytes each), others
+     * as a uint32 length followed by their text form. Each node record is followed by the records of its emitted
+     * children, so the forest can be rebuilt from `childCount` alone.
+     */
+    struct BinaryHeader {
+        char          magic[4] = { 'F', 'I', 'B', 'H' };
+        std::uint8_t  version = 1;
+        std::uint8_t  rawKeys = 0;
+        std::uint16_t keySize = 0;
+        std::uint64_t size = 0;
+        std::uint64_t rootCount = 0;
+    };
+
+    /**
+     * Collects output in a bufferSize chunk and hands full chunks to the sink, a callable taking (const char*, size_t).
+     */
+    template <typename Sink>
+    class ChunkWriter {
+    protected:
+        Sink&             sink;
+        std::vector<char> buffer;
+        size_t            used = 0;
+
+    public:
+        ChunkWriter(Sink& s, size_t size) : sink{ s }, buffer(size ? size : 1) {};
+        ChunkWriter(const ChunkWriter&) = delete;
+        ChunkWriter& operator= (const ChunkWriter&) = delete;
+        ~ChunkWriter() { flush(); };
+
+        void put(const char* data, size_t n);
+        void put(const char* text) { put(text, std::strlen(text)); };
+        void put(char c) { if (used == buffer.size()) flush(); buffer[used++] = c; };
+        template <typename U> void putRaw(const U& v) { put(reinterpret_cast<const char*>(&v), sizeof(U)); };
+        void putNumber(std::uint64_t v) { char tmp[24]; auto r = std::to_chars(tmp, tmp + sizeof(tmp), v); put(tmp, size_t(r.ptr - tmp)); };
+        void flush() { if (used) sink(buffer.data(), used); used = 0; };
+    };
+
+    template<typename Sink>
+    inline void ChunkWriter<Sink>::put(const char* data, size_t n) {
+        if (n > buffer.size() - used) {
+            flush();
+
+            if (n >= buffer.size()) {
+                sink(data, n);
+
+                return;
+            }
+        }
+
+        std::memcpy(buffer.data() + used, data, n);
+        used += n;
+    }
+
+    template <typename T>
+    inline constexpr bool is_plain_number = std::is_arithmetic_v<T> && !std::is_same_v<T, bool>;
+
+    /**
+     * Key as text: std::to_chars for numbers, operator<< for everything else. In JSON, non-numbers are quoted strings
+     * and non-finite floating point keys become null.
+     */
+    template <typename T, typename Sink>
+    inline void putKey_(ChunkWriter<Sink>& w, const T& v, bool json) {
+        if constexpr (is_plain_number<T>) {
+            if constexpr (std::is_floating_point_v<T>) {
+                if (json && !std::isfinite(v)) {
+                    w.put("null");
+
+                    return;
+                }
+            }
+
+            char tmp[64];
+            auto r = std::to_chars(tmp, tmp + sizeof(tmp), v);
+            w.put(tmp, size_t(r.ptr - tmp));
+        }
+        else {
+            std::ostringstream s;
+            s << v;
+            std::string text = s.str();
+
+            if (!json) {
+                w.put(text.data(), text.size());
+
+                return;
+            }
+
+            w.put('"');
+            for (char c : text) {
+                if (c == '"' || c == '\\') w.put('\\');
+                if (static_cast<unsigned char>(c) < 0x20) c = ' ';
+                w.put(c);
+            }
+            w.put('"');
+        }
+    }
+
+    template <typename T, typename Sink>
+    inline void putBinaryKey_(ChunkWriter<Sink>& w, const T& v) {
+        if constexpr (std::is_trivially_copyable_v<T>) w.putRaw(v);
+        else {
+            std::ostringstream s;
+            s << v;
+            std::string text = s.str();
+            w.putRaw(static_cast<std::uint32_t>(text.size()));
+            w.put(text.data(), text.size());
+        }
+    }
+
+    /**
+     * Writes the forest reachable from `root` (the heap's minimum) without recursion: every sibling ring being walked
+     * is one entry of an explicit stack, so arbitrarily deep trees are fine, and nothing in the nodes is modified, so
+     * the walk is safe on a heap that is only read. Returns the number of nodes written.
+     */
+    template <typename T, typename Sink> requires std::is_invocable_v<Sink&, const char*, size_t>
+    inline size_t writeForest(const algo::ds::fibo::node_impl::FiboNode<T>* root, size_t size, Sink&& sink, const DumpOptions& options = DumpOptions()) {
+        using node = algo::ds::fibo::node_impl::FiboNode<T>;
+
+        struct Frame {
+            const node* first;
+            const node* cur;
+            size_t      depth;
+            size_t      left;
+            size_t      parentId;
+            bool        started;
+        };
+
+        ChunkWriter<std::remove_reference_t<Sink>> w(sink, options.bufferSize);
+        const DumpFormat f = options.format;
+        size_t           rootCount = 0;
+
+        if (root && options.maxRoots) {
+            const node* r = root;
+
+            do {
+                rootCount++;
+                r = r->next;
+            } while (r != root && rootCount < options.maxRoots);
+        }
+
+        switch (f) {
+        case DumpFormat::Text:
+            w.put("size: ");
+            w.putNumber(size);
+            if (root) {
+                w.put(", minimum: ");
+                putKey_(w, root->value, false);
+            }
+            w.put('\n');
+            break;
+        case DumpFormat::Json:
+            w.put("{\"size\":");
+            w.putNumber(size);
+            w.put(",\"roots\":[");
+            break;
+        case DumpFormat::Dot:
+            w.put("digraph FibonacciHeap {\n  node [shape=circle];\n");
+            break;
+        case DumpFormat::Binary: {
+            BinaryHeader h;
+            h.rawKeys = std::is_trivially_copyable_v<T> ? 1 : 0;
+            h.keySize = static_cast<std::uint16_t>(sizeof(T));
+            h.size = size;
+            h.rootCount = rootCount;
+            w.putRaw(h);
+            break;
+        }
+        }
+
+        std::vector<Frame> stack;
+        size_t             written = 0;
+
+        if (rootCount) stack.push_back(Frame{ root, root, 0, rootCount, 0, false });
+        else if (f == DumpFormat::Json) w.put("]");
+
+        while (!stack.empty()) {
+            Frame& fr = stack.back();
+
+            if (fr.left == 0 || (fr.started && fr.cur == fr.first)) {
+                if (f == DumpFormat::Json) w.put(fr.depth ? "]}" : "]");
+
+                stack.pop_back();
+                continue;
+            }
+
+            const node* n = fr.cur;
+            size_t      depth = fr.depth;
+            size_t      parentId = fr.parentId;
+            bool        first = !fr.started;
+            bool        expand = n->child != nullptr && depth < options.maxDepth;
+            size_t      id = ++written;
+            fr.started = true;
+            fr.cur = n->next;
+            fr.left--;
+
+            switch (f) {
+            case DumpFormat::Text:
+                for (size_t i = 0; i < depth; ++i) w.put("  ", 2);
+                putKey_(w, n->value, false);
+                w.put(" (degree ");
+                w.putNumber(n->degree);
+                w.put(n->marked ? ", marked)\n" : ")\n");
+                break;
+            case DumpFormat::Json:
+                w.put(first ? "{\"key\":" : ",{\"key\":");
+                putKey_(w, n->value, true);
+                w.put(",\"degree\":");
+                w.putNumber(n->degree);
+                w.put(n->marked ? ",\"marked\":true" : ",\"marked\":false");
+                w.put(expand ? ",\"children\":[" : "}");
+                break;
+            case DumpFormat::Dot:
+                w.put("  n");
+                w.putNumber(id);
+                w.put(" [label=\"");
+                putKey_(w, n->value, false);
+                w.put(n->marked ? "\", style=filled];\n" : "\"];\n");
+                if (parentId) {
+                    w.put("  n");
+                    w.putNumber(parentId);
+                    w.put(" -> n");
+                    w.putNumber(id);
+                    w.put(";\n");
+                }
+                break;
+            case DumpFormat::Binary: {
+                std::uint32_t children = 0;
+
+                if (expand) {
+                    const node* c = n->child;
+
+                    do {
+                        children++;
+                        c = c->next;
+                    } while (c != n->child);
+                }
+
+                putBinaryKey_(w, n->value);
+                w.putRaw(children);
+                w.putRaw(static_cast<std::uint32_t>(n->degree));
+                w.putRaw(static_cast<std::uint8_t>(n->marked ? 1 : 0));
+                break;
+            }
+            }
+
+            if (expand) stack.push_back(Frame{ n->child, n->child, depth + 1, std::numeric_limits<size_t>::max(), id, false });
+        }
+
+        if (f == DumpFormat::Json) w.put("}\n");
+        if (f == DumpFormat::Dot) w.put("}\n");
+
+        return written;
+    }
+
+    /**
+     * Streams the dump into `os`, one write per chunk.
+     */
+    template <typename T>
+    inline size_t writeForest(const algo::ds::fibo::node_impl::FiboNode<T>* root, size_t size, std::ostream& os, const DumpOptions& options = DumpOptions()) {
+        auto sink = [&os](const char* data, size_t n) { os.write(data, static_cast<std::streamsize>(n)); };
+
+        return writeForest(root, size, sink, options);
+    }
+
+    /**
+     * Writes the dump into buffer[0, capacity) and returns the number of bytes the whole dump takes. As with snprintf,
+     * a result larger than capacity means the output was truncated.
+     */
+    template <typename T>
+    inline size_t writeForest(const algo::ds::fibo::node_impl::FiboNode<T>* root, size_t size, char* buffer, size_t capacity, const DumpOptions& options = DumpOptions()) {
+        size_t total = 0;
+        auto   sink = [&](const char* data, size_t n) {
+            if (total < capacity) std::memcpy(buffer + total, data, std::min(n, capacity - total));
+            total += n;
+        };
+
+        writeForest(root, size, sink, options);
+
+        return total;
+    }
+
+}
+
+#endif
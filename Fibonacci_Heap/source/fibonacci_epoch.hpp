@@ -0,0 +1,129 @@
+#ifndef FIBONACCIHEAP_FIBONACCI_EPOCH_HPP
+#define FIBONACCIHEAP_FIBONACCI_EPOCH_HPP
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace algo::ds::fibo::epoch {
+
+    /**
+     * Epoch-based reclamation for one writer and any number of readers. A reader pins the domain while it uses shared
+     * objects; the writer unlinks an object, retires it and calls collect(), which frees it once every reader pinned
+     * at the time of the retirement has unpinned. Pinning claims one of maxReaders slots (each on its own cache line)
+     * and publishes the current epoch there, so readers never write shared state another reader touches.
+     *
+     * retire() and collect() must only be called from the writer thread. The domain must outlive all guards.
+     */
+    class EpochDomain {
+    protected:
+        static constexpr std::uint64_t idle = std::numeric_limits<std::uint64_t>::max();
+
+        struct alignas(64) Slot {
+            std::atomic<bool>          used{ false };
+            std::atomic<std::uint64_t> epoch{ idle };
+        };
+
+        struct Retired {
+            void*         ptr;
+            void        (*deleter)(void*);
+            std::uint64_t epoch;
+        };
+
+        std::unique_ptr<Slot[]>    slots;
+        size_t                     numSlots;
+        std::atomic<std::uint64_t> global{ 0 };
+        std::vector<Retired>       limbo;
+
+    public:
+        class Guard {
+        private:
+            friend class EpochDomain;
+
+            Slot* slot;
+
+            explicit Guard(Slot* s) : slot{ s } {};
+
+        public:
+            Guard(const Guard&) = delete;
+            Guard(Guard&& s) noexcept : slot{ std::exchange(s.slot, nullptr) } {};
+            ~Guard() { if (slot) { slot->epoch.store(idle, std::memory_order_release); slot->used.store(false, std::memory_order_release); } };
+
+            Guard& operator= (const Guard&) = delete;
+            Guard& operator= (Guard&&) = delete;
+        };
+
+        explicit EpochDomain(size_t maxReaders = 64) : slots{ std::make_unique<Slot[]>(maxReaders ? maxReaders : 1) }, numSlots{ maxReaders ? maxReaders : 1 } {};
+        EpochDomain(const EpochDomain&) = delete;
+        EpochDomain& operator= (const EpochDomain&) = delete;
+        ~EpochDomain() { for (auto& r : limbo) r.deleter(r.ptr); };
+
+        [[nodiscard]] Guard  pin() const;
+        void                 retire(void* p, void (*deleter)(void*)) { limbo.push_back(Retired{ p, deleter, global.load(std::memory_order_relaxed) }); };
+        template <typename U>
+        void                 retire(U* p) { retire(p, [](void* q) { delete static_cast<U*>(q); }); };
+        size_t               collect();
+        [[nodiscard]] size_t pending() const { return limbo.size(); };
+        std::uint64_t        currentEpoch() const { return global.load(std::memory_order_relaxed); };
+    };
+
+    /**
+     * Claims a free slot, starting at one picked from the thread id so concurrent readers rarely probe the same slots,
+     * and announces the current epoch. Waits (yielding) while all slots are taken.
+     */
+    inline EpochDomain::Guard EpochDomain::pin() const {
+        size_t i = std::hash<std::thread::id>{}(std::this_thread::get_id()) % numSlots;
+
+        for (size_t probes = 0;; ++probes, i = (i + 1) % numSlots) {
+            if (probes && probes % numSlots == 0) std::this_thread::yield();
+
+            Slot& s = slots[i];
+
+            if (s.used.load(std::memory_order_relaxed) || s.used.exchange(true, std::memory_order_acquire)) continue;
+
+            // seq_cst orders the announcement before every load the reader makes under the guard, and against the
+            // writer's scan in collect(): a reader the scan misses can only see objects unlinked after that scan.
+            s.epoch.store(global.load(std::memory_order_seq_cst), std::memory_order_seq_cst);
+
+            return Guard(&s);
+        }
+    }
+
+    /**
+     * Advances the epoch if every pinned reader has seen the current one, then frees what was retired two or more
+     * epochs ago: no reader can still hold it. Returns the number of objects still waiting.
+     */
+    inline size_t EpochDomain::collect() {
+        std::uint64_t g = global.load(std::memory_order_relaxed);
+        bool          quiescent = true;
+
+        for (size_t i = 0; i < numSlots && quiescent; ++i) {
+            std::uint64_t e = slots[i].epoch.load(std::memory_order_seq_cst);
+
+            if (e != idle && e != g) quiescent = false;
+        }
+
+        if (quiescent) global.store(++g, std::memory_order_seq_cst);
+
+        size_t kept = 0;
+
+        for (auto& r : limbo) {
+            if (r.epoch + 2 <= g) r.deleter(r.ptr);
+            else limbo[kept++] = r;
+        }
+
+        limbo.resize(kept);
+
+        return kept;
+    }
+
+}
+
+#endif
@@ -0,0 +1,411 @@
+#ifndef FIBONACCIHEAP_FIBONACCI_EXTERNAL_HEAP_HPP
+#define FIBONACCIHEAP_FIBONACCI_EXTERNAL_HEAP_HPP
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <climits>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <functional>
+#include <queue>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "fibonacci_heap.hpp"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/types.h>
+#include <unistd.h>
+#endif
+
+namespace algo::ds::fibo::external {
+
+    struct ExternalOptions {
+        size_t      memoryBudget = size_t(64) << 20;  // bytes for the hot heap, the insert buffer and the run readers
+        size_t      ioBufferSize = size_t(256) << 10; // bytes per sequential read or write
+        std::string directory;                        // where a new, unshared spill file is created, empty for std::tmpfile()
+    };
+
+    /**
+     * Priority queue for more elements than fit in memory. The smallest keys live in a hot in-memory FibonacciHeap,
+     * every key on disk or in the insert buffer is >= `boundary`, and every key in the hot heap is <= it, so the hot
+     * minimum is the global minimum.
+     *
+     * - insert() below the boundary goes to the hot heap. When the hot heap outgrows its share of the budget it is
+     *   drained in order, the smaller half is kept and the larger half is written as a sorted run.
+     * - insert() at or above the boundary is appended to the insert buffer, which is sorted and written as a run when full.
+     * - When the hot heap drains, the runs are merged lazily: only enough keys to refill half of the hot heap are read,
+     *   each run through its own ioBufferSize read buffer.
+     *
+     * Runs are appended to a spill file, which is rewound once every run is consumed. When the run readers would exceed
+     * the budget, all runs are merged into one written to a new spill file that then replaces the old one, so the space
+     * of merged runs is given back and the files never hold much more than twice the spilled elements. Elements on disk have no node handles, so this mode offers
+     * insert/removeMinimum only; T must be trivially copyable.
+     */
+    template <typename T>
+    class ExternalFibonacciHeap {
+        static_assert(std::is_trivially_copyable_v<T>, "ExternalFibonacciHeap spills raw bytes, T must be trivially copyable");
+
+    protected:
+        struct Run {
+            std::uint64_t  offset;
+            size_t         remaining;
+            std::vector<T> buffer;
+            size_t         pos;
+        };
+
+        using head       = std::pair<T, size_t>;
+        using head_queue = std::priority_queue<head, std::vector<head>, std::greater<head>>;
+
+        ExternalOptions                  options;
+        algo::ds::fibo::FibonacciHeap<T> hot;
+        std::vector<T>                   insertBuffer;
+        std::vector<Run>                 runs;
+        head_queue                       heads;
+        std::FILE*                       file = nullptr;
+        std::filesystem::path            path;
+        std::uint64_t                    fileEnd = 0;
+        T                                boundary{};
+        bool                             hasBoundary = false;
+        size_t                           num_elems = 0;
+        size_t                           hotCapacity;
+        size_t                           bufferCapacity;
+        size_t                           maxRuns;
+        size_t                           bytesWritten = 0;
+        size_t                           bytesRead = 0;
+
+    public:
+        explicit ExternalFibonacciHeap(ExternalOptions o = ExternalOptions());
+        ExternalFibonacciHeap(const ExternalFibonacciHeap&) = delete;
+        ExternalFibonacciHeap& operator= (const ExternalFibonacciHeap&) = delete;
+        ~ExternalFibonacciHeap();
+
+        void               insert(T value);
+        T                    removeMinimum();
+        const T&             getMinimum() const { return hot.getRoot()->value; };
+        [[nodiscard]] bool   isEmpty()      const { return num_elems == 0; };
+        [[nodiscard]] size_t size()         const { return num_elems; };
+        [[nodiscard]] size_t inMemory()     const { return hot.size() + insertBuffer.size(); };
+        [[nodiscard]] size_t runCount()     const { return runs.size(); };
+        [[nodiscard]] size_t spilledBytes() const { return bytesWritten; };
+        [[nodiscard]] size_t loadedBytes()  const { return bytesRead; };
+
+    private:
+        void spillHot_();
+        void flushInsertBuffer_();
+        void refill_();
+        void mergeRuns_();
+        void addRun_(const T* data, size_t count);
+        void loadRun_(size_t index);
+        bool advance_(size_t index);
+        void writeAt_(std::FILE* f, std::uint64_t offset, const T* data, size_t count);
+        void readAt_(std::uint64_t offset, T* data, size_t count);
+        bool seek_(std::FILE* f, std::uint64_t offset);
+        void resetBoundary_();
+
+        std::FILE*  openSpillFile_(std::filesystem::path& created);
+        static void closeSpillFile_(std::FILE* f, const std::filesystem::path& created);
+    };
+
+    /**
+     * A quarter of the budget goes to the insert buffer and a quarter to run read buffers, the rest to hot heap nodes.
+     */
+    template<typename T>
+    inline ExternalFibonacciHeap<T>::ExternalFibonacciHeap(ExternalOptions o) : options{ std::move(o) } {
+        size_t ioElems = std::max<size_t>(1, options.ioBufferSize / sizeof(T));
+        bufferCapacity = std::max<size_t>(ioElems, options.memoryBudget / 4 / sizeof(T));
+        hotCapacity = std::max<size_t>(2, options.memoryBudget / 2 / sizeof(algo::ds::fibo::node_impl::FiboNode<T>));
+        maxRuns = std::max<size_t>(2, options.memoryBudget / 4 / (ioElems * sizeof(T)));
+        insertBuffer.reserve(bufferCapacity);
+
+        file = openSpillFile_(path);
+    }
+
+    /**
+     * Creates the spill file without ever opening an existing one, so heaps and processes sharing a directory cannot
+     * clobber each other's runs. On POSIX it comes from mkstemp() and is unlinked right away; elsewhere a new name is
+     * tried until fopen's exclusive "x" mode succeeds, its name is stored in `created` and closeSpillFile_ removes it.
+     * Throws std::runtime_error naming the directory and the cause if no file can be created.
+     */
+    template<typename T>
+    inline std::FILE* ExternalFibonacciHeap<T>::openSpillFile_(std::filesystem::path& created) {
+        std::FILE* f = nullptr;
+
+        created.clear();
+
+        if (options.directory.empty()) f = std::tmpfile();
+        else {
+#if defined(__unix__) || defined(__APPLE__)
+            std::string name = (std::filesystem::path(options.directory) / "fibonacci_heap_XXXXXX").string();
+            int         fd = mkstemp(name.data());
+
+            if (fd >= 0) {
+                std::remove(name.c_str());
+                f = fdopen(fd, "w+b");
+
+                if (f == nullptr) {
+                    int error = errno;
+                    close(fd);
+                    errno = error;
+                }
+            }
+#else
+            static std::atomic<unsigned> counter{ 0 };
+
+            for (int attempt = 0; attempt < 64 && f == nullptr; ++attempt) {
+                created = std::filesystem::path(options.directory) / ("fibonacci_heap_" + std::to_string(reinterpret_cast<std::uintptr_t>(this)) + "_" + std::to_string(counter++) + ".spill");
+                f = std::fopen(created.string().c_str(), "w+bx");
+
+                if (f == nullptr && errno != EEXIST) break;
+            }
+
+            if (f == nullptr) created.clear();
+#endif
+        }
+
+        if (f == nullptr) {
+            std::string where = options.directory.empty() ? std::string("tmpfile()") : options.directory;
+
+            throw std::runtime_error("ExternalFibonacciHeap: cannot create spill file in " + where + ": " + std::strerror(errno));
+        }
+
+        return f;
+    }
+
+    template<typename T>
+    inline void ExternalFibonacciHeap<T>::closeSpillFile_(std::FILE* f, const std::filesystem::path& created) {
+        std::fclose(f);
+
+        if (!created.empty()) {
+            std::error_code ec;
+            std::filesystem::remove(created, ec);
+        }
+    }
+
+    template<typename T>
+    inline ExternalFibonacciHeap<T>::~ExternalFibonacciHeap() {
+        hot.clear();
+        closeSpillFile_(file, path);
+    }
+
+    template<typename T>
+    inline void ExternalFibonacciHeap<T>::insert(T value) {
+        num_elems++;
+
+        if (!hasBoundary || value < boundary) {
+            hot.insert(value);
+
+            if (hot.size() > hotCapacity) spillHot_();
+
+            return;
+        }
+
+        insertBuffer.push_back(value);
+
+        if (insertBuffer.size() >= bufferCapacity) flushInsertBuffer_();
+    }
+
+    template<typename T>
+    inline T ExternalFibonacciHeap<T>::removeMinimum() {
+        T ret = hot.removeMinimum();
+        num_elems--;
+
+        if (hot.isEmpty() && num_elems > 0) refill_();
+
+        return ret;
+    }
+
+    template<typename T>
+    inline void ExternalFibonacciHeap<T>::spillHot_() {
+        std::vector<T> sorted;
+        sorted.reserve(hot.size());
+
+        while (!hot.isEmpty()) sorted.push_back(hot.removeMinimum());
+
+        size_t keep = sorted.size() / 2;
+        hot.build(sorted.begin(), sorted.begin() + keep, 1);
+        addRun_(sorted.data() + keep, sorted.size() - keep);
+        boundary = sorted[keep];
+        hasBoundary = true;
+    }
+
+    template<typename T>
+    inline void ExternalFibonacciHeap<T>::flushInsertBuffer_() {
+        if (insertBuffer.empty()) return;
+
+        std::sort(insertBuffer.begin(), insertBuffer.end());
+        addRun_(insertBuffer.data(), insertBuffer.size());
+        insertBuffer.clear();
+    }
+
+    template<typename T>
+    inline void ExternalFibonacciHeap<T>::refill_() {
+        flushInsertBuffer_();
+
+        std::vector<T> batch;
+        size_t                           take = std::min(hotCapacity / 2, num_elems);
+        batch.reserve(take);
+
+        while (batch.size() < take) {
+            auto [value, index] = heads.top();
+            heads.pop();
+            batch.push_back(value);
+
+            if (advance_(index)) heads.emplace(runs[index].buffer[runs[index].pos], index);
+        }
+
+        hot.build(batch.begin(), batch.end(), 1);
+        resetBoundary_();
+
+        if (heads.empty()) {
+            runs.clear();
+            fileEnd = 0;
+        }
+    }
+
+    /**
+     * Multiway merge of every run into a single new one, streaming through an ioBufferSize write buffer. The merged run
+     * goes to a new spill file, and closing the old one releases the space of all the runs it consumed.
+     */
+    template<typename T>
+    inline void ExternalFibonacciHeap<T>::mergeRuns_() {
+        size_t                ioElems = std::max<size_t>(1, options.ioBufferSize / sizeof(T));
+        size_t                total = 0;
+        std::vector<T>        out;
+        std::filesystem::path mergedPath;
+        std::FILE*            merged = openSpillFile_(mergedPath);
+
+        try {
+            out.reserve(ioElems);
+
+            while (!heads.empty()) {
+                auto [value, index] = heads.top();
+                heads.pop();
+                out.push_back(value);
+
+                if (advance_(index)) heads.emplace(runs[index].buffer[runs[index].pos], index);
+
+                if (out.size() == ioElems) {
+                    writeAt_(merged, total * sizeof(T), out.data(), out.size());
+                    total += out.size();
+                    out.clear();
+                }
+            }
+
+            writeAt_(merged, total * sizeof(T), out.data(), out.size());
+            total += out.size();
+        }
+        catch (...) {
+            closeSpillFile_(merged, mergedPath);
+            throw;
+        }
+
+        closeSpillFile_(file, path);
+        file = merged;
+        path = std::move(mergedPath);
+        fileEnd = total * sizeof(T);
+
+        runs.clear();
+        runs.push_back(Run{ 0, total, {}, 0 });
+        loadRun_(0);
+        heads.emplace(runs[0].buffer[0], 0);
+    }
+
+    template<typename T>
+    inline void ExternalFibonacciHeap<T>::addRun_(const T* data, size_t count) {
+        if (count == 0) return;
+
+        if (runs.size() >= maxRuns) mergeRuns_();
+
+        writeAt_(file, fileEnd, data, count);
+        runs.push_back(Run{ fileEnd, count, {}, 0 });
+        fileEnd += count * sizeof(T);
+
+        size_t index = runs.size() - 1;
+        loadRun_(index);
+        heads.emplace(runs[index].buffer[0], index);
+    }
+
+    template<typename T>
+    inline void ExternalFibonacciHeap<T>::loadRun_(size_t index) {
+        auto&                            r = runs[index];
+        size_t count = std::min(r.remaining, std::max<size_t>(1, options.ioBufferSize / sizeof(T)));
+        r.buffer.resize(count);
+        readAt_(r.offset, r.buffer.data(), count);
+        r.offset += count * sizeof(T);
+        r.remaining -= count;
+        r.pos = 0;
+    }
+
+    /**
+     * Moves the run past its head, returns false once it is exhausted.
+     */
+    template<typename T>
+    inline bool ExternalFibonacciHeap<T>::advance_(size_t index) {
+        auto& r = runs[index];
+
+        if (++r.pos < r.buffer.size()) return true;
+
+        if (r.remaining == 0) {
+            std::vector<T>().swap(r.buffer);
+
+            return false;
+        }
+
+        loadRun_(index);
+
+        return true;
+    }
+
+    template<typename T>
+    inline void ExternalFibonacciHeap<T>::writeAt_(std::FILE* f, std::uint64_t offset, const T* data, size_t count) {
+        if (count == 0) return;
+
+        if (!seek_(f, offset) || std::fwrite(data, sizeof(T), count, f) != count)
+            throw std::runtime_error("ExternalFibonacciHeap: spill write failed");
+
+        bytesWritten += count * sizeof(T);
+    }
+
+    template<typename T>
+    inline void ExternalFibonacciHeap<T>::readAt_(std::uint64_t offset, T* data, size_t count) {
+        if (!seek_(file, offset) || std::fread(data, sizeof(T), count, file) != count)
+            throw std::runtime_error("ExternalFibonacciHeap: spill read failed");
+
+        bytesRead += count * sizeof(T);
+    }
+
+    /**
+     * 64-bit seek: std::fseek takes a long, which is 32 bits on Windows, so spill files past 2 GB need the platform calls.
+     */
+    template<typename T>
+    inline bool ExternalFibonacciHeap<T>::seek_(std::FILE* f, std::uint64_t offset) {
+#if defined(_WIN32)
+        return _fseeki64(f, static_cast<__int64>(offset), SEEK_SET) == 0;
+#elif defined(__unix__) || defined(__APPLE__)
+        static_assert(sizeof(off_t) >= 8, "spill files need a 64-bit off_t, build with _FILE_OFFSET_BITS=64");
+
+        return fseeko(f, static_cast<off_t>(offset), SEEK_SET) == 0;
+#else
+        return offset <= static_cast<std::uint64_t>(LONG_MAX) && std::fseek(f, static_cast<long>(offset), SEEK_SET) == 0;
+#endif
+    }
+
+    template<typename T>
+    inline void ExternalFibonacciHeap<T>::resetBoundary_() {
+        hasBoundary = !heads.empty();
+
+        if (hasBoundary) boundary = heads.top().first;
+    }
+
+}
+
+#endif
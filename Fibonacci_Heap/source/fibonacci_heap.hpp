@@ -3,50 +3,112 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <span>
+#include <thread>
+#include <type_traits>
+#include <vector>
 #include "fibonacci_iterator.hpp"
 #include "fibonacci_reverse_iterator.hpp"
 #include "fibonacci_const_iterator.hpp"
 #include "fibonacci_const_reverse_iterator.hpp"
+#include "fibonacci_simd.hpp"
+#include "fibonacci_dump.hpp"
 
 namespace algo::ds::fibo {
 
-    template <typename T>
+    /**
+     * Nodes are allocated through `Allocator` rebound to FiboNode<T>, e.g. std::pmr::polymorphic_allocator<T> to place
+     * them in a monotonic or pool memory resource (see algo::ds::fibo::pmr::FibonacciHeap). Heaps exchanging nodes via
+     * merge() or splitRoots() must use allocators that compare equal. release() forgets all nodes without freeing them,
+     * for arena-backed heaps whose memory is reclaimed by resetting the resource. compact() moves the nodes the heap
+     * allocated itself into depth-first order, to undo the scattering left behind by long churn.
+     */
+    template <typename T, typename Allocator = std::allocator<T>>
     class FibonacciHeap {
     public:
         /**
          * TODO : make ReverseIterator and ConstReverseIterator work also after minimum extraction (make getPrevNodeForIteration() works corectly)
         */
+        using allocator_type = Allocator;
 
     protected:
+        using node_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<algo::ds::fibo::node_impl::FiboNode<T>>;
+        using node_traits    = std::allocator_traits<node_allocator>;
+
+        struct CompactFrame {
+            algo::ds::fibo::node_impl::FiboNode<T>* first;
+            algo::ds::fibo::node_impl::FiboNode<T>* cur;
+            bool                                    descended;
+        };
+
         algo::ds::fibo::node_impl::FiboNode<T>* heap;
-        T                                       currMax = -1;
+        T                                       currMax{};
+        bool                                    maxStale = false;
         size_t                                  num_elems;
         bool                                    wasDeletion = false;
+        node_allocator                          alloc;
+        std::vector<algo::ds::fibo::node_impl::FiboNode<T>*> rootBuffer;
+        size_t                                  consolidationThreads = 1;
+        size_t                                  parallelThreshold = size_t(1) << 16;
+        std::vector<CompactFrame>               compactStack;
+        std::vector<algo::ds::fibo::node_impl::FiboNode<T>*> retired;
+        size_t                                  mutations = 0;
+        size_t                                  compactMutations = 0;
+        std::uint8_t                            compactEpoch = 0;
+        bool                                    compactPending = false;
+        bool                                    callerNodes = false;
 
     public:
         FibonacciHeap() : heap{ empty_() }, num_elems{ 0 } {};
+        explicit FibonacciHeap(const Allocator& a) : heap{ empty_() }, num_elems{ 0 }, alloc{ a } {};
         explicit FibonacciHeap(algo::ds::fibo::node_impl::FiboNode<T>& s) : heap{ s }, num_elems{ 0 } {};
-        FibonacciHeap(const FibonacciHeap& s) : heap{ s.heap }, num_elems{ s.num_elems } {};
-        FibonacciHeap(FibonacciHeap&& s) noexcept : heap{ s.heap }, num_elems{ s.num_elems } {};
+        FibonacciHeap(const FibonacciHeap& s) : heap{ s.heap }, currMax{ s.currMax }, maxStale{ s.maxStale }, num_elems{ s.num_elems }, alloc{ s.alloc }, callerNodes{ s.callerNodes } {};
+        FibonacciHeap(FibonacciHeap&& s) noexcept : heap{ s.heap }, currMax{ s.currMax }, maxStale{ s.maxStale }, num_elems{ s.num_elems }, alloc{ s.alloc }, callerNodes{ s.callerNodes } {};
 
         algo::ds::fibo::node_impl::FiboNode<T>* insert(T);
+        algo::ds::fibo::node_impl::FiboNode<T>* insertNode(algo::ds::fibo::node_impl::FiboNode<T>*);
         void                                    merge(FibonacciHeap&);
+        template <typename Range> void          meld(Range&& heaps);
+        template <typename It> void             build(It first, It last, size_t threads = std::thread::hardware_concurrency());
+        void                                    setParallelConsolidation(size_t threads, size_t threshold = size_t(1) << 16) { consolidationThreads = threads ? threads : 1; parallelThreshold = std::max<size_t>(threshold, 2); };
         T                                       removeMinimum();
+        algo::ds::fibo::node_impl::FiboNode<T>* extractMinimumNode();
+        void                                    extractNode(algo::ds::fibo::node_impl::FiboNode<T>*);
+        template <typename F> size_t            extractUpTo(const T&, F&&);
+        size_t                                  splitRoots(FibonacciHeap& into) { return splitRoots(into, [](algo::ds::fibo::node_impl::FiboNode<T>*) {}); };
+        template <typename F> size_t            splitRoots(FibonacciHeap&, F&&);
+        bool                                    compact() { return compact([](algo::ds::fibo::node_impl::FiboNode<T>*, algo::ds::fibo::node_impl::FiboNode<T>*) {}); };
+        template <typename F> bool              compact(F&& onMove, std::chrono::nanoseconds budget = std::chrono::nanoseconds::max());
         void                                    displayHeap();
-        void                                    decreaseKey(algo::ds::fibo::node_impl::FiboNode<T>* n, T value) { heap = decreaseKey_(heap, n, value); };
+        size_t                                  dump(std::ostream& os, const algo::ds::fibo::io::DumpOptions& o = algo::ds::fibo::io::DumpOptions()) const { return algo::ds::fibo::io::writeForest(heap, num_elems, os, o); };
+        size_t                                  dump(char* buffer, size_t capacity, const algo::ds::fibo::io::DumpOptions& o = algo::ds::fibo::io::DumpOptions()) const { return algo::ds::fibo::io::writeForest(heap, num_elems, buffer, capacity, o); };
+        void                                    decreaseKey(algo::ds::fibo::node_impl::FiboNode<T>* n, T value) { mutations++; heap = decreaseKey_(heap, n, value); };
+        void                                    decreaseKeys(std::span<const std::pair<algo::ds::fibo::node_impl::FiboNode<T>*, T>>);
         algo::ds::fibo::node_impl::FiboNode<T>* find(T value) { return find_(heap, value); };
         [[nodiscard]] bool                      isEmpty()                                                 const { return heap == nullptr; };
         [[nodiscard]] size_t                    size()                                                    const { return num_elems; };
         T                                       getMinimum() { return heap->value; };
         algo::ds::fibo::node_impl::FiboNode<T>* getRoot()                                                 const { return heap; };
-        algo::ds::fibo::node_impl::FiboNode<T>* getCurrMax()                                              const { return find(currMax); };
+        algo::ds::fibo::node_impl::FiboNode<T>* getCurrMax() { return find_(heap, getMaximum()); };
+        T                                       getMaximum() { if (maxStale) refreshMax_(); return currMax; };
         void                                    clear() { while (!isEmpty()) { removeMinimum(); } };
+        void                                    release() { heap = empty_(); num_elems = 0; wasDeletion = false; maxStale = false; callerNodes = false; mutations++; retired.clear(); };
+        allocator_type                          get_allocator()                                           const { return allocator_type(alloc); };
 
-        FibonacciHeap<T>& operator= (const FibonacciHeap<T>& o) { if (this != &o) { num_elems = o.num_elems; wasDeletion = o.wasDeletion; heap = o.heap; } return *this; };
-        FibonacciHeap<T>& operator= (FibonacciHeap<T>&& o) noexcept { num_elems = o.num_elems; wasDeletion = o.wasDeletion; heap = o.heap; return *this; };
-        bool              operator==(const FibonacciHeap<T>& o) { return (num_elems == o.num_elems && wasDeletion == o.wasDeletion && heap == o.heap); };
-        bool              operator!=(const FibonacciHeap<T>& o) { return !(*this == o); };
-        FibonacciHeap<T>& operator+ (const FibonacciHeap<T>& o) { merge(o); return *this; };
+        FibonacciHeap& operator= (const FibonacciHeap& o) { if (this != &o) { num_elems = o.num_elems; wasDeletion = o.wasDeletion; heap = o.heap; currMax = o.currMax; maxStale = o.maxStale; callerNodes = o.callerNodes; mutations++; } return *this; };
+        FibonacciHeap& operator= (FibonacciHeap&& o) noexcept { num_elems = o.num_elems; wasDeletion = o.wasDeletion; heap = o.heap; currMax = o.currMax; maxStale = o.maxStale; callerNodes = o.callerNodes; mutations++; return *this; };
+        bool           operator==(const FibonacciHeap& o) { return (num_elems == o.num_elems && wasDeletion == o.wasDeletion && heap == o.heap); };
+        bool           operator!=(const FibonacciHeap& o) { return !(*this == o); };
+        FibonacciHeap& operator+ (FibonacciHeap& o) { merge(o); return *this; };
 
         algo::ds::fibo::iterators::Iterator<T>             begin() { return algo::ds::fibo::iterators::Iterator<T>(heap, heap, wasDeletion); };
         algo::ds::fibo::iterators::Iterator<T>             end() { return algo::ds::fibo::iterators::Iterator<T>(wasDeletion); };
@@ -61,23 +123,37 @@ namespace algo::ds::fibo {
         algo::ds::fibo::node_impl::FiboNode<T>* empty_() { return nullptr; }
         algo::ds::fibo::node_impl::FiboNode<T>* singleton_(T);
         algo::ds::fibo::node_impl::FiboNode<T>* merge_(algo::ds::fibo::node_impl::FiboNode<T>*, algo::ds::fibo::node_impl::FiboNode<T>*);
+        void                                    splice_(algo::ds::fibo::node_impl::FiboNode<T>*, algo::ds::fibo::node_impl::FiboNode<T>*);
         void                                    addChild(algo::ds::fibo::node_impl::FiboNode<T>*, algo::ds::fibo::node_impl::FiboNode<T>*);
         void                                    unMarAndUnParentAll_(algo::ds::fibo::node_impl::FiboNode<T>*);
         algo::ds::fibo::node_impl::FiboNode<T>* removeMinimum_(algo::ds::fibo::node_impl::FiboNode<T>*);
+        algo::ds::fibo::node_impl::FiboNode<T>* consolidate_(algo::ds::fibo::node_impl::FiboNode<T>*);
+        void                                    gatherRoots_(algo::ds::fibo::node_impl::FiboNode<T>*);
+        void                                    linkByDegreeParallel_(algo::ds::fibo::node_impl::FiboNode<T>**);
+        void                                    linkByDegree_(algo::ds::fibo::node_impl::FiboNode<T>**, algo::ds::fibo::node_impl::FiboNode<T>**, algo::ds::fibo::node_impl::FiboNode<T>**);
+        algo::ds::fibo::node_impl::FiboNode<T>* rebuildRoots_(algo::ds::fibo::node_impl::FiboNode<T>**);
         algo::ds::fibo::node_impl::FiboNode<T>* cut_(algo::ds::fibo::node_impl::FiboNode<T>*, algo::ds::fibo::node_impl::FiboNode<T>*);
+        void                                    detachFromParent_(algo::ds::fibo::node_impl::FiboNode<T>*);
+        algo::ds::fibo::node_impl::FiboNode<T>* cascadingCut_(algo::ds::fibo::node_impl::FiboNode<T>*, algo::ds::fibo::node_impl::FiboNode<T>*);
+        void                                    noteInserted_(const T&);
+        void                                    noteRemoved_(const T&);
+        void                                    absorbMax_(const T&, bool);
+        void                                    refreshMax_();
+        void                                    resetNode_(algo::ds::fibo::node_impl::FiboNode<T>*);
+        void                                    destroyRing_(algo::ds::fibo::node_impl::FiboNode<T>*);
+        template <typename F>
+        algo::ds::fibo::node_impl::FiboNode<T>* relocate_(algo::ds::fibo::node_impl::FiboNode<T>*, F&);
+        void                                    releaseRetired_();
         algo::ds::fibo::node_impl::FiboNode<T>* decreaseKey_(algo::ds::fibo::node_impl::FiboNode<T>*, algo::ds::fibo::node_impl::FiboNode<T>*, T);
         algo::ds::fibo::node_impl::FiboNode<T>* find_(algo::ds::fibo::node_impl::FiboNode<T>*, T);
-        void                                    displayHeap_(algo::ds::fibo::node_impl::FiboNode<T>*);
-        void                                    displayChildrens_(algo::ds::fibo::node_impl::FiboNode<T>*);
     };
 
-    template<class T>
-    inline algo::ds::fibo::node_impl::FiboNode<T>* FibonacciHeap<T>::insert(T value) {
+    template<class T, class Allocator>
+    inline algo::ds::fibo::node_impl::FiboNode<T>* FibonacciHeap<T, Allocator>::insert(T value) {
         algo::ds::fibo::node_impl::FiboNode<T>* ret = singleton_(value);
         if (ret) {
             num_elems++;
-
-            if (ret->value > currMax) currMax = ret->value;
+            noteInserted_(ret->value);
         }
 
         heap = merge_(heap, ret);
@@ -85,46 +161,533 @@ namespace algo::ds::fibo {
         return ret;
     }
 
-    template<class T>
-    inline void FibonacciHeap<T>::merge(FibonacciHeap& other) {
+    template<class T, class Allocator>
+    inline algo::ds::fibo::node_impl::FiboNode<T>* FibonacciHeap<T, Allocator>::insertNode(algo::ds::fibo::node_impl::FiboNode<T>* n) {
+        resetNode_(n);
+        num_elems++;
+        callerNodes = true;
+        noteInserted_(n->value);
+
+        heap = merge_(heap, n);
+
+        return n;
+    }
+
+    template<class T, class Allocator>
+    inline void FibonacciHeap<T, Allocator>::merge(FibonacciHeap& other) {
+        if (this == &other || other.isEmpty()) return;
+
+        absorbMax_(other.currMax, other.maxStale);
         heap = merge_(heap, other.heap);
+        num_elems += other.num_elems;
+        wasDeletion = wasDeletion || other.wasDeletion;
+        callerNodes = callerNodes || other.callerNodes;
         other.heap = empty_();
+        other.num_elems = 0;
+        other.wasDeletion = false;
+        other.maxStale = false;
+        other.callerNodes = false;
+        other.mutations++;
     }
 
-    template<class T>
-    inline T FibonacciHeap<T>::removeMinimum() {
+    /**
+     * Melds a range of heaps (or of pointers to heaps) into this one: every root ring is spliced in one pass and the
+     * new minimum is picked among the k old minima, so combining k heaps is O(k). The melded heaps are left empty.
+     */
+    template<class T, class Allocator>
+    template<typename Range>
+    inline void FibonacciHeap<T, Allocator>::meld(Range&& heaps) {
+        auto* min = heap;
+
+        for (auto&& h : heaps) {
+            FibonacciHeap* o;
+
+            if constexpr (std::is_pointer_v<std::remove_reference_t<decltype(h)>>) o = h;
+            else o = &h;
+
+            if (o == nullptr || o == this || o->isEmpty()) continue;
+
+            absorbMax_(o->currMax, o->maxStale);
+
+            if (min == nullptr) min = o->heap;
+            else {
+                splice_(min, o->heap);
+
+                if (o->heap->value < min->value) min = o->heap;
+            }
+
+            num_elems += o->num_elems;
+            wasDeletion = wasDeletion || o->wasDeletion;
+            callerNodes = callerNodes || o->callerNodes;
+            o->heap = empty_();
+            o->num_elems = 0;
+            o->wasDeletion = false;
+            o->maxStale = false;
+            o->callerNodes = false;
+            o->mutations++;
+        }
+
+        heap = min;
+    }
+
+    /**
+     * Bulk-inserts [first, last) using up to `threads` threads. Every thread links its slice into binomial trees with a
+     * local degree table (at most one tree per degree) and threads them into a ring whose minimum it reports; the rings
+     * are then spliced into the heap, so the next removeMinimum consolidates O(threads * log n) roots instead of n.
+     * Linking each node right after it is constructed, while it is still in cache, is cheaper than consolidating the
+     * same roots later, so this pays off even with one thread. With std::allocator the threads allocate their own
+     * nodes, other allocators are only used from the calling thread. If an allocation or a copy of an element throws,
+     * the exception is rethrown after all threads joined, every node built so far is freed and the heap is unchanged.
+     */
+    template<class T, class Allocator>
+    template<typename It>
+    inline void FibonacciHeap<T, Allocator>::build(It first, It last, size_t threads) {
+        constexpr bool concurrentAlloc = std::is_same_v<node_allocator, std::allocator<algo::ds::fibo::node_impl::FiboNode<T>>>;
+        constexpr size_t minChunk = 1 << 14;
+
+        size_t n = static_cast<size_t>(std::distance(first, last));
+
+        if (n == 0) return;
+
+        threads = std::max<size_t>(1, std::min(threads, (n + minChunk - 1) / minChunk));
+
+        struct Part {
+            algo::ds::fibo::node_impl::FiboNode<T>* trees[64] = { nullptr };
+            algo::ds::fibo::node_impl::FiboNode<T>* min = nullptr;
+            algo::ds::fibo::node_impl::FiboNode<T>* unconstructed = nullptr;
+            T                                       max{};
+            size_t                                  count = 0;
+            std::exception_ptr                      error;
+        };
+
+        std::vector<Part>                                    parts(threads);
+        std::vector<It>                                      bounds{ first };
+        std::vector<algo::ds::fibo::node_impl::FiboNode<T>*> preallocated;
+        std::vector<std::thread>                             workers;
+
+        workers.reserve(threads - 1);
+        for (size_t t = 1; t < threads; ++t) bounds.push_back(std::next(bounds.back(), n / threads));
+        bounds.push_back(last);
+
+        if constexpr (!concurrentAlloc) {
+            preallocated.reserve(n);
+
+            try {
+                for (size_t i = 0; i < n; ++i) preallocated.push_back(node_traits::allocate(alloc, 1));
+            }
+            catch (...) {
+                for (auto* x : preallocated) node_traits::deallocate(alloc, x, 1);
+                throw;
+            }
+        }
+
+        // Every constructed node is linked into part.trees before anything else can throw, so the error path below finds
+        // all of them, and the first part.count preallocated nodes of a part are exactly the constructed ones.
+        auto work = [&](size_t t) {
+            auto&  part = parts[t];
+            size_t offset = t * (n / threads);
+
+            try {
+                for (auto it = bounds[t]; it != bounds[t + 1]; ++it, ++offset) {
+                    algo::ds::fibo::node_impl::FiboNode<T>* x;
+
+                    if constexpr (concurrentAlloc) x = part.unconstructed = node_traits::allocate(alloc, 1);
+                    else x = preallocated[offset];
+
+                    node_traits::construct(alloc, x, *it);
+                    part.unconstructed = nullptr;
+                    resetNode_(x);
+
+                    linkByDegree_(&x, &x + 1, part.trees);
+
+                    if (part.count++ == 0 || part.max < x->value) part.max = x->value;
+                }
+
+                if (part.count) part.min = rebuildRoots_(part.trees);
+            }
+            catch (...) {
+                part.error = std::current_exception();
+            }
+        };
+
+        for (size_t t = 1; t < threads; ++t) {
+            try {
+                workers.emplace_back(work, t);
+            }
+            catch (...) {
+                work(t);
+            }
+        }
+
+        work(0);
+
+        for (auto& w : workers) w.join();
+
+        auto failed = std::find_if(parts.begin(), parts.end(), [](const Part& p) { return p.error != nullptr; });
+
+        if (failed != parts.end()) {
+            for (size_t t = 0; t < threads; ++t) {
+                auto& p = parts[t];
+
+                if (p.min) destroyRing_(p.min);
+                else {
+                    for (auto* r : p.trees) {
+                        if (r == nullptr) continue;
+
+                        r->next = r->prev = r;
+                        destroyRing_(r);
+                    }
+                }
+
+                if constexpr (concurrentAlloc) {
+                    if (p.unconstructed) node_traits::deallocate(alloc, p.unconstructed, 1);
+                }
+                else {
+                    size_t end = t + 1 == threads ? n : (t + 1) * (n / threads);
+
+                    for (size_t i = t * (n / threads) + p.count; i < end; ++i) node_traits::deallocate(alloc, preallocated[i], 1);
+                }
+            }
+
+            std::rethrow_exception(failed->error);
+        }
+
+        for (auto& part : parts) {
+            if (part.min == nullptr) continue;
+
+            absorbMax_(part.max, false);
+            heap = merge_(heap, part.min);
+            num_elems += part.count;
+        }
+
+        wasDeletion = true;
+    }
+
+    /**
+     * Moves about half of the trees of the root list (never the minimum) into another heap with one O(1) splice. When
+     * the minimum is the only root, half of its children are moved instead. The visitor is called for every moved
+     * node, which is also how the moved elements are counted, so the cost is proportional to the work handed over.
+     * Returns the number of moved nodes.
+     */
+    template<class T, class Allocator>
+    template<typename F>
+    inline size_t FibonacciHeap<T, Allocator>::splitRoots(FibonacciHeap& into, F&& visitor) {
+        if (heap == nullptr) return 0;
+
+        algo::ds::fibo::node_impl::FiboNode<T>* ring = heap;
+        algo::ds::fibo::node_impl::FiboNode<T>* first = heap->next;
+
+        if (first == heap) {
+            if (heap->child == nullptr) return 0;
+
+            ring = heap->child;
+            first = ring->next;
+        }
+
+        size_t ringSize = 1;
+
+        for (auto* c = ring->next; c != ring; c = c->next) ringSize++;
+
+        size_t take = ringSize / 2;
+
+        if (take == 0) {
+            if (ring == heap) return 0;
+
+            take = 1;
+            first = ring;
+        }
+
+        auto* last = first;
+
+        for (size_t i = 1; i < take; ++i) last = last->next;
+
+        if (ring != heap) {
+            heap->degree -= static_cast<int>(take);
+            heap->child = (take == ringSize) ? nullptr : last->next;
+        }
+
+        if (take < ringSize) {
+            first->prev->next = last->next;
+            last->next->prev = first->prev;
+        }
+
+        first->prev = last;
+        last->next = first;
+
+        std::vector<algo::ds::fibo::node_impl::FiboNode<T>*> stack;
+        auto*                                                segMin = first;
+        auto*                                                segMax = first;
+        size_t                                               moved = 0;
+        auto*                                                c = first;
+
+        do {
+            c->parent = nullptr;
+            c->marked = false;
+
+            if (c->value < segMin->value) segMin = c;
+
+            stack.push_back(c);
+            c = c->next;
+        } while (c != first);
+
+        while (!stack.empty()) {
+            auto* n = stack.back();
+            stack.pop_back();
+            moved++;
+
+            if (n->value > segMax->value) segMax = n;
+
+            visitor(n);
+
+            if (n->child) {
+                auto* d = n->child;
+
+                do {
+                    stack.push_back(d);
+                    d = d->next;
+                } while (d != n->child);
+            }
+        }
+
+        into.absorbMax_(segMax->value, false);
+        into.heap = merge_(into.heap, segMin);
+        into.num_elems += moved;
+        into.wasDeletion = true;
+        into.callerNodes = into.callerNodes || callerNodes;
+        num_elems -= moved;
+        wasDeletion = true;
+        noteRemoved_(segMax->value);
+
+        return moved;
+    }
+
+    /**
+     * Moves every node into a fresh allocation in depth-first order (each root followed by its subtree), so that after
+     * long churn the forest is allocated again in the order traversals walk it. The old nodes are freed only when the
+     * pass ends, so the new ones cannot land in the holes the pass itself vacates; whether they end up contiguous is up
+     * to the allocator, whose free lists (pools, the huge page arena) may still hand out older holes first. onMove(old,
+     * moved) is called for each node so external handles can be updated, `old` only identifies the handle, its value
+     * has been moved out.
+     *
+     * With a budget the pass runs incrementally: it stops once the budget is spent and returns false, and the next
+     * call carries on. Every node remembers the pass that moved it, so a mutation in between only restarts the walk:
+     * it starts again from the roots, skipping the nodes this pass has already moved (and the ones allocated since it
+     * began), and the retired nodes stay allocated until the pass ends. Each call moves at least one batch of nodes
+     * before it looks at the budget, so on a live heap every slice makes progress and the pass finishes, at the price
+     * of re-walking the already moved part of the forest after each mutation. Returns true when the pass is complete. Nodes added
+     * with insertNode() belong to the caller and cannot be moved, so while any may be in the heap compact() does
+     * nothing and returns true. Iterators and the node pointers returned by insert() are invalidated.
+     */
+    template<class T, class Allocator>
+    template<typename F>
+    inline bool FibonacciHeap<T, Allocator>::compact(F&& onMove, std::chrono::nanoseconds budget) {
+        using clock = std::chrono::steady_clock;
+
+        if (callerNodes || heap == nullptr) {
+            compactStack.clear();
+            compactPending = false;
+            releaseRetired_();
+
+            return true;
+        }
+
+        bool   timed = budget != std::chrono::nanoseconds::max();
+        auto   deadline = timed ? clock::now() + budget : clock::time_point::max();
+        size_t steps = 0;
+        size_t moved = 0;
+        auto   visit = [&](algo::ds::fibo::node_impl::FiboNode<T>* n) {
+            if (n->compactEpoch == compactEpoch) return n;
+
+            moved++;
+
+            return relocate_(n, onMove);
+        };
+
+        if (!compactPending) {
+            compactEpoch++;
+            compactPending = true;
+            compactStack.clear();
+        }
+
+        // the frames may point at nodes a mutation has extracted or relinked, so walk again from the roots
+        if (compactStack.empty() || compactMutations != mutations) {
+            compactStack.clear();
+
+            auto* r = visit(heap);
+            compactStack.push_back(CompactFrame{ r, r, false });
+            compactMutations = mutations;
+        }
+
+        while (!compactStack.empty()) {
+            if (timed && (++steps & 63) == 0 && moved >= 64 && clock::now() >= deadline) return false;
+
+            auto& f = compactStack.back();
+
+            if (!f.descended && f.cur->child) {
+                f.descended = true;
+                auto* c = visit(f.cur->child);
+                compactStack.push_back(CompactFrame{ c, c, false });
+
+                continue;
+            }
+
+            if (f.cur->next == f.first) {
+                compactStack.pop_back();
+
+                continue;
+            }
+
+            f.cur = visit(f.cur->next);
+            f.descended = false;
+        }
+
+        compactPending = false;
+        releaseRetired_();
+
+        return true;
+    }
+
+    template<class T, class Allocator>
+    inline T FibonacciHeap<T, Allocator>::removeMinimum() {
+        auto* old = extractMinimumNode();
+        auto ret = old->value;
+        node_traits::destroy(alloc, old);
+        node_traits::deallocate(alloc, old, 1);
+
+        return ret;
+    }
+
+    /**
+     * Unlinks the minimum node without freeing it, so that callers owning their nodes (see insertNode) can reuse them.
+     */
+    template<class T, class Allocator>
+    inline algo::ds::fibo::node_impl::FiboNode<T>* FibonacciHeap<T, Allocator>::extractMinimumNode() {
         auto* old = heap;
         heap = removeMinimum_(heap);
-        auto ret = old->value;
-        delete old;
         num_elems--;
         wasDeletion = true;
+        noteRemoved_(old->value);
+        resetNode_(old);
 
-        return ret;
+        return old;
     }
 
-    template<typename T>
-    inline void FibonacciHeap<T>::displayHeap() {
-        if (isEmpty()) std::cout << "Heap is empty!" << std::endl;
-        else displayHeap_(heap);
+    /**
+     * Unlinks an arbitrary node without freeing it. The node is cut to the root list (with cascading cuts) and its
+     * children are spliced into the root list, no consolidation is done unless the node was the minimum.
+     */
+    template<class T, class Allocator>
+    inline void FibonacciHeap<T, Allocator>::extractNode(algo::ds::fibo::node_impl::FiboNode<T>* n) {
+        if (n == heap) {
+            extractMinimumNode();
+
+            return;
+        }
+
+        if (n->parent) heap = cascadingCut_(heap, n);
+
+        unMarAndUnParentAll_(n->child);
+        n->next->prev = n->prev;
+        n->prev->next = n->next;
+        heap = merge_(heap, n->child);
+        num_elems--;
+        wasDeletion = true;
+        noteRemoved_(n->value);
+        resetNode_(n);
     }
 
-    template<class T>
-    inline algo::ds::fibo::node_impl::FiboNode<T>* FibonacciHeap<T>::singleton_(T value) {
-        auto n = new algo::ds::fibo::node_impl::FiboNode<T>;
-        n->value = value;
+    /**
+     * Unlinks every node with value <= bound in one pass and consolidates the remaining forest once. Heap order means
+     * only the expired prefix of every tree is visited. The visitor is called with each unlinked node in ascending
+     * order after the heap is consistent again, so it may safely insert into the heap. Returns the number of nodes.
+     */
+    template<class T, class Allocator>
+    template<typename F>
+    inline size_t FibonacciHeap<T, Allocator>::extractUpTo(const T& bound, F&& visitor) {
+        if (heap == nullptr || bound < heap->value) return 0;
+
+        std::vector<algo::ds::fibo::node_impl::FiboNode<T>*> stack;
+        std::vector<algo::ds::fibo::node_impl::FiboNode<T>*> extracted;
+        algo::ds::fibo::node_impl::FiboNode<T>*              survivors = empty_();
+        auto*                                                r = heap;
+
+        do {
+            stack.push_back(r);
+            r = r->next;
+        } while (r != heap);
+
+        for (auto* root : stack) {
+            root->next = root->prev = root;
+            root->parent = nullptr;
+        }
+
+        for (size_t i = 0; i < stack.size(); ++i) {
+            if (bound < stack[i]->value) {
+                survivors = merge_(survivors, stack[i]);
+                stack[i] = nullptr;
+            }
+        }
+
+        while (!stack.empty()) {
+            auto* n = stack.back();
+            stack.pop_back();
+
+            if (n == nullptr) continue;
+
+            extracted.push_back(n);
+
+            auto* c = n->child;
+
+            if (c) {
+                do {
+                    auto* next = c->next;
+                    c->next = c->prev = c;
+                    c->parent = nullptr;
+                    c->marked = false;
+
+                    if (bound < c->value) survivors = merge_(survivors, c);
+                    else stack.push_back(c);
+
+                    c = next;
+                } while (c != n->child);
+            }
+        }
+
+        heap = survivors ? consolidate_(survivors) : empty_();
+        num_elems -= extracted.size();
+        wasDeletion = true;
+        noteRemoved_(bound);
+
+        std::sort(extracted.begin(), extracted.end(), [](const auto* a, const auto* b) { return a->value < b->value; });
+        for (auto* n : extracted) resetNode_(n);
+        for (auto* n : extracted) visitor(n);
+
+        return extracted.size();
+    }
+
+    template<typename T, typename Allocator>
+    inline void FibonacciHeap<T, Allocator>::displayHeap() {
+        if (isEmpty()) std::cout << "Heap is empty!\n";
+        else dump(std::cout, algo::ds::fibo::io::DumpOptions{ algo::ds::fibo::io::DumpFormat::Text });
+    }
+
+    template<class T, class Allocator>
+    inline algo::ds::fibo::node_impl::FiboNode<T>* FibonacciHeap<T, Allocator>::singleton_(T value) {
+        auto n = node_traits::allocate(alloc, 1);
+        node_traits::construct(alloc, n, value);
         n->prev = n;
         n->next = n;
         n->degree = 0;
         n->marked = false;
         n->child = nullptr;
         n->parent = nullptr;
+        n->compactEpoch = compactEpoch;
 
         return n;
     }
 
-    template<class T>
-    inline algo::ds::fibo::node_impl::FiboNode<T>* FibonacciHeap<T>::merge_(algo::ds::fibo::node_impl::FiboNode<T>* a, algo::ds::fibo::node_impl::FiboNode<T>* b) {
+    template<class T, class Allocator>
+    inline algo::ds::fibo::node_impl::FiboNode<T>* FibonacciHeap<T, Allocator>::merge_(algo::ds::fibo::node_impl::FiboNode<T>* a, algo::ds::fibo::node_impl::FiboNode<T>* b) {
         if (a == nullptr) return b;
         if (b == nullptr) return a;
         if (a->value > b->value) {
@@ -133,18 +696,23 @@ namespace algo::ds::fibo {
             b = temp;
         }
 
+        splice_(a, b);
+
+        return a;
+    }
+
+    template<class T, class Allocator>
+    inline void FibonacciHeap<T, Allocator>::splice_(algo::ds::fibo::node_impl::FiboNode<T>* a, algo::ds::fibo::node_impl::FiboNode<T>* b) {
         auto* an = a->next;
         auto* bp = b->prev;
         a->next = b;
         b->prev = a;
         an->prev = bp;
         bp->next = an;
-
-        return a;
     }
 
-    template<class T>
-    inline void FibonacciHeap<T>::addChild(algo::ds::fibo::node_impl::FiboNode<T>* parent, algo::ds::fibo::node_impl::FiboNode<T>* child) {
+    template<class T, class Allocator>
+    inline void FibonacciHeap<T, Allocator>::addChild(algo::ds::fibo::node_impl::FiboNode<T>* parent, algo::ds::fibo::node_impl::FiboNode<T>* child) {
         child->prev = child;
         child->next = child;
         child->parent = parent;
@@ -152,8 +720,8 @@ namespace algo::ds::fibo {
         parent->child = merge_(parent->child, child);
     }
 
-    template<class T>
-    inline void FibonacciHeap<T>::unMarAndUnParentAll_(algo::ds::fibo::node_impl::FiboNode<T>* n) {
+    template<class T, class Allocator>
+    inline void FibonacciHeap<T, Allocator>::unMarAndUnParentAll_(algo::ds::fibo::node_impl::FiboNode<T>* n) {
         if (n == nullptr) return;
 
         auto* c = n;
@@ -165,8 +733,8 @@ namespace algo::ds::fibo {
         } while (c != n);
     }
 
-    template<class T>
-    inline algo::ds::fibo::node_impl::FiboNode<T>* FibonacciHeap<T>::removeMinimum_(algo::ds::fibo::node_impl::FiboNode<T>* n) {
+    template<class T, class Allocator>
+    inline algo::ds::fibo::node_impl::FiboNode<T>* FibonacciHeap<T, Allocator>::removeMinimum_(algo::ds::fibo::node_impl::FiboNode<T>* n) {
         unMarAndUnParentAll_(n->child);
 
         if (n->next == n) n = n->child;
@@ -176,64 +744,189 @@ namespace algo::ds::fibo {
             n = merge_(n->next, n->child);
         }
 
+        return consolidate_(n);
+    }
+
+    /**
+     * Does not throw on allocation failure: if the root buffer cannot grow, nothing has been relinked yet, so the roots
+     * are left unconsolidated and only their minimum is returned. The next removal tries again.
+     */
+    template<class T, class Allocator>
+    inline algo::ds::fibo::node_impl::FiboNode<T>* FibonacciHeap<T, Allocator>::consolidate_(algo::ds::fibo::node_impl::FiboNode<T>* n) {
         if (n == nullptr) return n;
 
         algo::ds::fibo::node_impl::FiboNode<T>* trees[64] = { nullptr };
 
-        while (true) {
-            if (trees[n->degree] != nullptr) {
-                auto* t = trees[n->degree];
+        try {
+            gatherRoots_(n);
+        }
+        catch (const std::bad_alloc&) {
+            auto* min = n;
+
+            for (auto* c = n->next; c != n; c = c->next) {
+                if (c->value < min->value) min = c;
+            }
 
-                if (t == n) break;
+            return min;
+        }
 
-                trees[n->degree] = nullptr;
+        if (consolidationThreads > 1 && rootBuffer.size() >= parallelThreshold) linkByDegreeParallel_(trees);
+        else linkByDegree_(rootBuffer.data(), rootBuffer.data() + rootBuffer.size(), trees);
 
-                if (n->value < t->value) {
-                    t->prev->next = t->next;
-                    t->next->prev = t->prev;
-                    addChild(n, t);
-                }
-                else {
-                    t->prev->next = t->next;
-                    t->next->prev = t->prev;
-
-                    if (n->next == n) {
-                        t->next = t;
-                        t->prev = t;
-                        addChild(t, n);
-                        n = t;
-                    }
-                    else {
-                        n->prev->next = t;
-                        n->next->prev = t;
-                        t->next = n->next;
-                        t->prev = n->prev;
-                        addChild(t, n);
-                        n = t;
-                    }
-                }
+        return rebuildRoots_(trees);
+    }
 
-                continue;
+    /**
+     * Parallel variant of phase two for huge root lists (see setParallelConsolidation): every worker links its slice of
+     * the root buffer with a private degree table, then the at most 64 survivors of each table are linked sequentially.
+     */
+    template<class T, class Allocator>
+    inline void FibonacciHeap<T, Allocator>::linkByDegreeParallel_(algo::ds::fibo::node_impl::FiboNode<T>** trees) {
+        size_t threads = std::min(consolidationThreads, rootBuffer.size() / 2);
+
+        if (threads < 2) {
+            linkByDegree_(rootBuffer.data(), rootBuffer.data() + rootBuffer.size(), trees);
+
+            return;
+        }
+
+        size_t chunk = rootBuffer.size() / threads;
+
+        std::vector<std::array<algo::ds::fibo::node_impl::FiboNode<T>*, 64>> partial;
+        std::vector<std::thread>                                              workers;
+        auto*                                                                 roots = rootBuffer.data();
+
+        try {
+            partial.resize(threads);
+            workers.reserve(threads - 1);
+        }
+        catch (const std::bad_alloc&) {
+            linkByDegree_(roots, roots + rootBuffer.size(), trees);
+
+            return;
+        }
+
+        for (auto& p : partial) p.fill(nullptr);
+
+        // a worker that cannot be started links its slice on this thread instead
+        for (size_t t = 1; t < threads; ++t) {
+            auto* last = (t + 1 == threads) ? roots + rootBuffer.size() : roots + (t + 1) * chunk;
+            auto  work = [this, &partial, roots, chunk, last, t]() { linkByDegree_(roots + t * chunk, last, partial[t].data()); };
+
+            try {
+                workers.emplace_back(work);
+            }
+            catch (...) {
+                work();
             }
-            else  trees[n->degree] = n;
+        }
 
-            n = n->next;
+        linkByDegree_(roots, roots + chunk, partial[0].data());
+
+        for (auto& w : workers) w.join();
+
+        algo::ds::fibo::node_impl::FiboNode<T>* survivors[64];
+
+        for (auto& p : partial) {
+            size_t count = 0;
+
+            for (auto* r : p) {
+                if (r) survivors[count++] = r;
+            }
+
+            linkByDegree_(survivors, survivors + count, trees);
         }
+    }
 
-        auto* min = n;
-        auto* start = n;
+    /**
+     * Phase one of consolidation: copies the root ring into a contiguous buffer, prefetching ahead of the walk, so the
+     * linking phase reads roots from an array instead of chasing next pointers.
+     */
+    template<class T, class Allocator>
+    inline void FibonacciHeap<T, Allocator>::gatherRoots_(algo::ds::fibo::node_impl::FiboNode<T>* n) {
+        rootBuffer.clear();
+
+        auto* c = n;
 
         do {
-            if (n->value < min->value) min = n;
+#if defined(__GNUC__) || defined(__clang__)
+            __builtin_prefetch(c->next->next);
+#endif
+            rootBuffer.push_back(c);
+            c = c->next;
+        } while (c != n);
+    }
 
-            n = n->next;
-        } while (n != start);
+    /**
+     * Phase two: links the roots of [first, last) by degree. Survivors are left in trees[] (their sibling links are
+     * stale until rebuildRoots_), so partial tables of disjoint ranges can be combined by linking them again.
+     */
+    template<class T, class Allocator>
+    inline void FibonacciHeap<T, Allocator>::linkByDegree_(algo::ds::fibo::node_impl::FiboNode<T>** first, algo::ds::fibo::node_impl::FiboNode<T>** last, algo::ds::fibo::node_impl::FiboNode<T>** trees) {
+        for (auto** it = first; it != last; ++it) {
+#if defined(__GNUC__) || defined(__clang__)
+            if (last - it > 8) __builtin_prefetch(it[8]);
+#endif
+            auto* x = *it;
+
+            while (trees[x->degree] != nullptr) {
+                auto* y = trees[x->degree];
+                trees[x->degree] = nullptr;
+
+                if (y->value < x->value) std::swap(x, y);
+
+                addChild(x, y);
+            }
+
+            trees[x->degree] = x;
+        }
+    }
+
+    /**
+     * Phase three: threads the surviving trees into the new root ring and returns the minimum, found with a vectorized
+     * argmin over the survivors' keys for int/float/double and with a scalar scan otherwise.
+     */
+    template<class T, class Allocator>
+    inline algo::ds::fibo::node_impl::FiboNode<T>* FibonacciHeap<T, Allocator>::rebuildRoots_(algo::ds::fibo::node_impl::FiboNode<T>** trees) {
+        algo::ds::fibo::node_impl::FiboNode<T>* survivors[64];
+        size_t                                  count = 0;
+
+        for (size_t d = 0; d < 64; ++d) {
+            if (trees[d]) survivors[count++] = trees[d];
+        }
+
+        for (size_t i = 0; i < count; ++i) {
+            survivors[i]->next = survivors[(i + 1) % count];
+            survivors[i]->prev = survivors[(i + count - 1) % count];
+        }
+
+        if constexpr (algo::ds::fibo::simd::has_vector_argmin<T>) {
+            T keys[64];
+
+            for (size_t i = 0; i < count; ++i) keys[i] = survivors[i]->value;
+
+            return survivors[algo::ds::fibo::simd::argmin(keys, count)];
+        }
+        else {
+            auto* min = survivors[0];
+
+            for (size_t i = 1; i < count; ++i) {
+                if (survivors[i]->value < min->value) min = survivors[i];
+            }
 
-        return min;
+            return min;
+        }
     }
 
-    template<class T>
-    inline algo::ds::fibo::node_impl::FiboNode<T>* FibonacciHeap<T>::cut_(algo::ds::fibo::node_impl::FiboNode<T>* heap_, algo::ds::fibo::node_impl::FiboNode<T>* n) {
+    template<class T, class Allocator>
+    inline algo::ds::fibo::node_impl::FiboNode<T>* FibonacciHeap<T, Allocator>::cut_(algo::ds::fibo::node_impl::FiboNode<T>* heap_, algo::ds::fibo::node_impl::FiboNode<T>* n) {
+        detachFromParent_(n);
+
+        return merge_(heap_, n);
+    }
+
+    template<class T, class Allocator>
+    inline void FibonacciHeap<T, Allocator>::detachFromParent_(algo::ds::fibo::node_impl::FiboNode<T>* n) {
         if (n->next == n) n->parent->child = nullptr;
         else {
             n->next->prev = n->prev;
@@ -241,41 +934,252 @@ namespace algo::ds::fibo {
             n->parent->child = n->next;
         }
 
+        n->parent->degree--;
         n->next = n->prev = n;
         n->marked = false;
+    }
 
-        return merge_(heap_, n);
+    template<class T, class Allocator>
+    inline algo::ds::fibo::node_impl::FiboNode<T>* FibonacciHeap<T, Allocator>::cascadingCut_(algo::ds::fibo::node_impl::FiboNode<T>* heap_, algo::ds::fibo::node_impl::FiboNode<T>* n) {
+        heap_ = cut_(heap_, n);
+        auto* parent = n->parent;
+        n->parent = nullptr;
+
+        while (parent != nullptr && parent->marked) {
+            heap_ = cut_(heap_, parent);
+            n = parent;
+            parent = n->parent;
+            n->parent = nullptr;
+        }
+
+        if (parent != nullptr && parent->parent != nullptr) parent->marked = true;
+
+        return heap_;
+    }
+
+    /**
+     * currMax is exact unless maxStale is set, in which case it is an upper bound left behind by removing or decreasing
+     * the maximum; getMaximum() then recomputes it with one traversal. noteInserted_ and noteRemoved_ are called after
+     * num_elems has been updated, absorbMax_ before. Being called on every structural change, they also count the
+     * mutations that invalidate an incremental compact() pass.
+     */
+    template<class T, class Allocator>
+    inline void FibonacciHeap<T, Allocator>::noteInserted_(const T& value) {
+        mutations++;
+
+        if (num_elems == 1 || value > currMax) {
+            currMax = value;
+            maxStale = false;
+        }
+    }
+
+    template<class T, class Allocator>
+    inline void FibonacciHeap<T, Allocator>::noteRemoved_(const T& value) {
+        mutations++;
+
+        if (num_elems == 0) {
+            maxStale = false;
+            callerNodes = false;
+        }
+        else if (!(value < currMax)) maxStale = true;
+    }
+
+    template<class T, class Allocator>
+    inline void FibonacciHeap<T, Allocator>::absorbMax_(const T& value, bool stale) {
+        mutations++;
+
+        if (num_elems == 0 || value > currMax) {
+            currMax = value;
+            maxStale = stale;
+        }
+        else if (!(value < currMax)) maxStale = maxStale && stale;
+    }
+
+    template<class T, class Allocator>
+    inline void FibonacciHeap<T, Allocator>::refreshMax_() {
+        if (heap == nullptr) {
+            maxStale = false;
+
+            return;
+        }
+
+        // if the stack cannot be allocated, maxStale stays set and currMax keeps its (upper bound) value
+        std::vector<algo::ds::fibo::node_impl::FiboNode<T>*> stack{ heap };
+        T                                                    max = heap->value;
+
+        while (!stack.empty()) {
+            auto* first = stack.back();
+            auto* c = first;
+            stack.pop_back();
+
+            do {
+                if (c->value > max) max = c->value;
+                if (c->child) stack.push_back(c->child);
+
+                c = c->next;
+            } while (c != first);
+        }
+
+        currMax = max;
+        maxStale = false;
+    }
+
+    template<class T, class Allocator>
+    inline void FibonacciHeap<T, Allocator>::resetNode_(algo::ds::fibo::node_impl::FiboNode<T>* n) {
+        n->prev = n;
+        n->next = n;
+        n->degree = 0;
+        n->marked = false;
+        n->child = nullptr;
+        n->parent = nullptr;
+        n->compactEpoch = compactEpoch;
+    }
+
+    /**
+     * Destroys and deallocates every node of n's ring and all of their descendants. Children are spliced into the ring
+     * as their parent is reached, so the walk needs no stack and cannot throw.
+     */
+    template<class T, class Allocator>
+    inline void FibonacciHeap<T, Allocator>::destroyRing_(algo::ds::fibo::node_impl::FiboNode<T>* n) {
+        while (n) {
+            if (n->child) {
+                splice_(n, n->child);
+                n->child = nullptr;
+            }
+
+            auto* next = n->next == n ? nullptr : n->next;
+            n->prev->next = n->next;
+            n->next->prev = n->prev;
+            node_traits::destroy(alloc, n);
+            node_traits::deallocate(alloc, n, 1);
+            n = next;
+        }
+    }
+
+    /**
+     * Copies `old` into a new node and repoints its siblings, parent, children and the heap pointer at the copy, so
+     * the forest is consistent again before the next step. The old node is destroyed but kept allocated in `retired`.
+     */
+    template<class T, class Allocator>
+    template<typename F>
+    inline algo::ds::fibo::node_impl::FiboNode<T>* FibonacciHeap<T, Allocator>::relocate_(algo::ds::fibo::node_impl::FiboNode<T>* old, F& onMove) {
+        if (retired.size() == retired.capacity()) retired.reserve(2 * retired.size() + 64);
+
+        auto* n = node_traits::allocate(alloc, 1);
+        node_traits::construct(alloc, n, std::move(old->value));
+        n->child = old->child;
+        n->parent = old->parent;
+        n->degree = old->degree;
+        n->marked = old->marked;
+        n->iterMarked = old->iterMarked;
+        n->compactEpoch = compactEpoch;
+
+        if (old->next == old) n->prev = n->next = n;
+        else {
+            n->prev = old->prev;
+            n->next = old->next;
+            old->prev->next = n;
+            old->next->prev = n;
+        }
+
+        if (n->parent && n->parent->child == old) n->parent->child = n;
+
+        if (auto* c = n->child) {
+            do {
+                c->parent = n;
+                c = c->next;
+            } while (c != n->child);
+        }
+
+        if (heap == old) heap = n;
+
+        onMove(old, n);
+        node_traits::destroy(alloc, old);
+        retired.push_back(old);
+
+        return n;
     }
 
-    template<class T>
-    inline algo::ds::fibo::node_impl::FiboNode<T>* FibonacciHeap<T>::decreaseKey_(algo::ds::fibo::node_impl::FiboNode<T>* heap_, algo::ds::fibo::node_impl::FiboNode<T>* n, T value) {
+    template<class T, class Allocator>
+    inline void FibonacciHeap<T, Allocator>::releaseRetired_() {
+        for (auto* n : retired) node_traits::deallocate(alloc, n, 1);
+
+        retired.clear();
+    }
+
+    template<class T, class Allocator>
+    inline algo::ds::fibo::node_impl::FiboNode<T>* FibonacciHeap<T, Allocator>::decreaseKey_(algo::ds::fibo::node_impl::FiboNode<T>* heap_, algo::ds::fibo::node_impl::FiboNode<T>* n, T value) {
         if (n->value < value) return heap_;
+        if (value < n->value && !(n->value < currMax)) maxStale = true;
 
         n->value = value;
 
         if (n->parent) {
-            if (n->value < n->parent->value) {
-                heap_ = cut_(heap_, n);
-                auto* parent = n->parent;
-                n->parent = nullptr;
-
-                while (parent != nullptr && parent->marked) {
-                    heap_ = cut_(heap_, parent);
-                    n = parent;
-                    parent = n->parent;
-                    n->parent = nullptr;
-                }
-
-                if (parent != nullptr && parent->parent != nullptr) parent->marked = true;
-            }
+            if (n->value < n->parent->value) heap_ = cascadingCut_(heap_, n);
         }
         else if (n->value < heap_->value) heap_ = n;
 
         return heap_;
     }
 
-    template<class T>
-    inline algo::ds::fibo::node_impl::FiboNode<T>* FibonacciHeap<T>::find_(algo::ds::fibo::node_impl::FiboNode<T>* heap_, T value) {
+    /**
+     * Batched decreaseKey: all keys are written first, then every node that now violates heap order is cut together
+     * with its marked ancestors in one pass. Nodes already cut as an ancestor of an earlier node are skipped, the cut
+     * trees are collected in a private ring spliced into the root list once, and the minimum is updated once.
+     * Updates that would increase a key are ignored, as in decreaseKey.
+     */
+    template<class T, class Allocator>
+    inline void FibonacciHeap<T, Allocator>::decreaseKeys(std::span<const std::pair<algo::ds::fibo::node_impl::FiboNode<T>*, T>> updates) {
+        std::vector<algo::ds::fibo::node_impl::FiboNode<T>*> violators;
+        algo::ds::fibo::node_impl::FiboNode<T>*              min = heap;
+
+        mutations++;
+
+        for (const auto& [n, value] : updates) {
+            if (n->value < value) continue;
+            if (value < n->value && !(n->value < currMax)) maxStale = true;
+
+            n->value = value;
+
+            if (n->parent) violators.push_back(n);
+            else if (n->value < min->value) min = n;
+        }
+
+        algo::ds::fibo::node_impl::FiboNode<T>* ring = empty_();
+
+        auto collect = [&](algo::ds::fibo::node_impl::FiboNode<T>* n) {
+            detachFromParent_(n);
+            n->parent = nullptr;
+
+            if (ring) splice_(ring, n);
+            else ring = n;
+
+            if (n->value < min->value) min = n;
+        };
+
+        for (auto* n : violators) {
+            auto* parent = n->parent;
+
+            if (parent == nullptr || !(n->value < parent->value)) continue;
+
+            collect(n);
+
+            while (parent != nullptr && parent->marked) {
+                auto* next = parent->parent;
+                collect(parent);
+                parent = next;
+            }
+
+            if (parent != nullptr && parent->parent != nullptr) parent->marked = true;
+        }
+
+        if (ring) splice_(heap, ring);
+
+        heap = min;
+    }
+
+    template<class T, class Allocator>
+    inline algo::ds::fibo::node_impl::FiboNode<T>* FibonacciHeap<T, Allocator>::find_(algo::ds::fibo::node_impl::FiboNode<T>* heap_, T value) {
         auto* n = heap_;
 
         if (n == nullptr) return nullptr;
@@ -292,44 +1196,12 @@ namespace algo::ds::fibo {
         return nullptr;
     }
 
-    template<typename T>
-    inline void FibonacciHeap<T>::displayHeap_(algo::ds::fibo::node_impl::FiboNode<T>* in) {
-        if (in) {
-            auto* c = in;
-
-            std::cout << "Minimum -> " << heap->value << std::endl;
-            do {
-                displayChildrens_(c);
-                c = c->next;
-            } while (c != in);
-        }
-    }
+}
 
-    template<typename T>
-    inline void FibonacciHeap<T>::displayChildrens_(algo::ds::fibo::node_impl::FiboNode<T>* n) {
-        if (n) {
-            std::cout << "value: " << n->value << (n->marked ? " (marked)" : " (not marked)") << " -> next: "
-                << n->next->value << (n->next->marked ? " (marked)" : " (not marked)") << std::endl;
-            std::cout << "value: " << n->value << (n->marked ? " (marked)" : " (not marked)") << " -> prev: "
-                << n->prev->value << (n->prev->marked ? " (marked)" : " (not marked)") << std::endl;
-            if (n->hasParent())
-                std::cout << "value: " << n->value << (n->marked ? " (marked)" : " (not marked)") << " -> parent: "
-                << n->parent->value << (n->parent->marked ? " (marked)" : " (not marked)") << std::endl;
-            else std::cout << "No parent" << std::endl;
+namespace algo::ds::fibo::pmr {
 
-            if (n->hasChildren()) {
-                auto* c = n->child;
-                do {
-                    std::cout << "parent value: " << n->value << (n->marked ? " (marked)" : " (not marked)")
-                        << " -> child: " << n->child->value << (n->child->marked ? " (marked)" : " (not marked)")
-                        << std::endl << std::endl;
-                    displayChildrens_(c);
-                    c = c->next;
-                } while (c != n->child);
-            }
-            else std::cout << "No child" << std::endl;
-        }
-    }
+    template <typename T>
+    using FibonacciHeap = algo::ds::fibo::FibonacciHeap<T, std::pmr::polymorphic_allocator<T>>;
 
 }
 
@@ -0,0 +1,237 @@
+#ifndef FIBONACCIHEAP_FIBONACCI_KEY_PACKER_HPP
+#define FIBONACCIHEAP_FIBONACCI_KEY_PACKER_HPP
+
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <limits>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace algo::ds::fibo::keys {
+
+    enum class Order {
+        Ascending,
+        Descending
+    };
+
+    /**
+     * One field of a packed key: Bits of an integral, enum or floating point T. Integers are stored offset (signed
+     * ones biased by 2^(Bits-1)) and saturate at the field's range, floating point values keep the top Bits of their
+     * order-preserving IEEE encoding, with -0.0 stored as +0.0. Either way a <= b implies pack(a) <= pack(b).
+     */
+    template <typename T, unsigned Bits = sizeof(T) * 8, Order O = Order::Ascending>
+    struct Field {
+        using type = T;
+
+        static constexpr unsigned bits = Bits;
+        static constexpr Order    order = O;
+        static constexpr bool     sequence = false;
+    };
+
+    /**
+     * Insertion counter in the lowest Bits of the key, so equal fields pop in FIFO order. It wraps after 2^Bits keys.
+     */
+    template <unsigned Bits>
+    struct Sequence {
+        using type = std::uint64_t;
+
+        static constexpr unsigned bits = Bits;
+        static constexpr Order    order = Order::Ascending;
+        static constexpr bool     sequence = true;
+    };
+
+    template <unsigned Bits>
+    struct KeyWord {
+#if defined(__SIZEOF_INT128__)
+        static_assert(Bits <= 128, "packed key wider than 128 bits");
+
+        using type = std::conditional_t<(Bits <= 64), std::uint64_t, unsigned __int128>;
+#else
+        static_assert(Bits <= 64, "packed key wider than 64 bits");
+
+        using type = std::uint64_t;
+#endif
+    };
+
+    /**
+     * Packs a tuple of fields into one unsigned integer whose natural order is the lexicographic order of the fields
+     * (first field most significant), so a FibonacciHeap<key_type> compares a single machine word (or a pair for keys
+     * wider than 64 bits) instead of calling a multi-field operator<. The layout is fixed at compile time; an optional
+     * Sequence field, which must come last, is filled from the packer's counter.
+     *
+     *     using Packer = KeyPacker<Field<std::int16_t>, Field<std::uint32_t>, Sequence<16>>;
+     *     Packer p;
+     *     FibonacciHeap<Packer::key_type> h;
+     *     h.insert(p.pack(priority, deadline));
+     */
+    template <typename... Fields>
+    class KeyPacker {
+    public:
+        static constexpr unsigned totalBits = (Fields::bits + ...);
+        static constexpr size_t   numFields = sizeof...(Fields);
+        static constexpr bool     hasSequence = std::tuple_element_t<numFields - 1, std::tuple<Fields...>>::sequence;
+        static constexpr size_t   valueFields = hasSequence ? numFields - 1 : numFields;
+
+        using key_type = typename KeyWord<totalBits>::type;
+
+        static_assert(((Fields::bits > 0 && Fields::bits <= 64) && ...), "every field needs 1 to 64 bits");
+        static_assert(((!Fields::sequence) + ...) == valueFields, "only the last field may be a Sequence");
+
+    protected:
+        template <size_t I>
+        using field = std::tuple_element_t<I, std::tuple<Fields...>>;
+
+        // shift of each field, the first one ends at the most significant bit
+        static constexpr std::array<unsigned, numFields> offsets = [] {
+            std::array<unsigned, numFields> r{};
+            unsigned                        bits[] = { Fields::bits... };
+            unsigned                        offset = totalBits;
+
+            for (size_t i = 0; i < numFields; ++i) r[i] = offset -= bits[i];
+
+            return r;
+        }();
+
+        std::uint64_t nextSequence;
+
+    public:
+        constexpr explicit KeyPacker(std::uint64_t firstSequence = 0) : nextSequence{ firstSequence } {};
+
+        template <typename... Args>
+        constexpr key_type pack(Args... args);
+        template <typename... Args>
+        static constexpr key_type packWithSequence(std::uint64_t sequence, Args... args);
+        template <size_t I>
+        static constexpr typename field<I>::type get(key_type key);
+        constexpr std::uint64_t sequence() const { return nextSequence; };
+
+    private:
+        static constexpr std::uint64_t mask_(unsigned bits) { return bits >= 64 ? ~std::uint64_t(0) : (std::uint64_t(1) << bits) - 1; };
+        template <typename F, typename V>
+        static constexpr std::uint64_t encode_(V v);
+        template <typename F>
+        static constexpr typename F::type decode_(std::uint64_t u);
+    };
+
+    /**
+     * Packs the value fields and, if the layout has one, the next sequence number.
+     */
+    template<typename... Fields>
+    template<typename... Args>
+    constexpr typename KeyPacker<Fields...>::key_type KeyPacker<Fields...>::pack(Args... args) {
+        if constexpr (hasSequence) return packWithSequence(nextSequence++, args...);
+        else return packWithSequence(0, args...);
+    }
+
+    template<typename... Fields>
+    template<typename... Args>
+    constexpr typename KeyPacker<Fields...>::key_type KeyPacker<Fields...>::packWithSequence(std::uint64_t sequence, Args... args) {
+        static_assert(sizeof...(Args) == valueFields, "pack() takes one argument per non-sequence field");
+
+        auto     values = std::make_tuple(args...);
+        key_type key = 0;
+
+        [&]<size_t... I>(std::index_sequence<I...>) {
+            ((key |= key_type(encode_<field<I>>(std::get<I>(values))) << offsets[I]), ...);
+        }(std::make_index_sequence<valueFields>{});
+
+        if constexpr (hasSequence) key |= key_type(sequence & mask_(field<numFields - 1>::bits));
+
+        return key;
+    }
+
+    /**
+     * Field I of a packed key. Exact for integers within the field's range, floating point fields narrower than their
+     * type come back rounded to the bits that were kept.
+     */
+    template<typename... Fields>
+    template<size_t I>
+    constexpr typename KeyPacker<Fields...>::template field<I>::type KeyPacker<Fields...>::get(key_type key) {
+        using F = field<I>;
+
+        return decode_<F>(static_cast<std::uint64_t>(key >> offsets[I]) & mask_(F::bits));
+    }
+
+    /**
+     * Integers are clamped in the argument's own type, so an out of range value saturates instead of wrapping.
+     */
+    template<typename... Fields>
+    template<typename F, typename V>
+    constexpr std::uint64_t KeyPacker<Fields...>::encode_(V v) {
+        using T = typename F::type;
+
+        constexpr unsigned B = F::bits;
+        std::uint64_t      u;
+
+        if constexpr (std::is_enum_v<T>) {
+            return encode_<Field<std::underlying_type_t<T>, B, F::order>>(static_cast<std::underlying_type_t<T>>(static_cast<T>(v)));
+        }
+        else if constexpr (std::is_floating_point_v<T>) {
+            static_assert(sizeof(T) == 4 || sizeof(T) == 8, "only float and double fields are supported");
+            static_assert(B <= sizeof(T) * 8, "floating point field wider than its type");
+
+            using word = std::conditional_t<sizeof(T) == 4, std::uint32_t, std::uint64_t>;
+
+            constexpr word sign = word(1) << (sizeof(T) * 8 - 1);
+            T              f = static_cast<T>(v);
+
+            if (f == T(0)) f = T(0);  // -0.0 == +0.0, so both must pack to the same key
+
+            word bits = std::bit_cast<word>(f);
+            bits = (bits & sign) ? word(~bits) : word(bits | sign);
+            u = std::uint64_t(bits) >> (sizeof(T) * 8 - B);
+        }
+        else if constexpr (!std::is_integral_v<V>) {
+            return encode_<F>(static_cast<T>(v));
+        }
+        else if constexpr (std::is_signed_v<T>) {
+            constexpr std::int64_t lo = B >= 64 ? std::numeric_limits<std::int64_t>::min() : -(std::int64_t(1) << (B - 1));
+            constexpr std::int64_t hi = B >= 64 ? std::numeric_limits<std::int64_t>::max() : (std::int64_t(1) << (B - 1)) - 1;
+            auto                   w = +v;  // promotes bool and character types, which std::cmp_less rejects
+            std::int64_t           s = std::cmp_less(w, lo) ? lo : (std::cmp_greater(w, hi) ? hi : std::int64_t(w));
+            u = std::uint64_t(s) - std::uint64_t(lo);
+        }
+        else {
+            auto w = +v;
+            u = std::cmp_less(w, 0) ? 0 : (std::cmp_greater(w, mask_(B)) ? mask_(B) : std::uint64_t(w));
+        }
+
+        return F::order == Order::Descending ? mask_(B) - u : u;
+    }
+
+    template<typename... Fields>
+    template<typename F>
+    constexpr typename F::type KeyPacker<Fields...>::decode_(std::uint64_t u) {
+        using T = typename F::type;
+
+        constexpr unsigned B = F::bits;
+
+        if (F::order == Order::Descending) u = mask_(B) - u;
+
+        if constexpr (std::is_enum_v<T>) {
+            return static_cast<T>(decode_<Field<std::underlying_type_t<T>, B>>(u));
+        }
+        else if constexpr (std::is_floating_point_v<T>) {
+            using word = std::conditional_t<sizeof(T) == 4, std::uint32_t, std::uint64_t>;
+
+            constexpr word sign = word(1) << (sizeof(T) * 8 - 1);
+            word           bits = word(u << (sizeof(T) * 8 - B));
+            bits = (bits & sign) ? word(bits & ~sign) : word(~bits);
+
+            return std::bit_cast<T>(bits);
+        }
+        else if constexpr (std::is_signed_v<T>) {
+            constexpr std::int64_t lo = B >= 64 ? std::numeric_limits<std::int64_t>::min() : -(std::int64_t(1) << (B - 1));
+
+            return static_cast<T>(std::int64_t(u + std::uint64_t(lo)));
+        }
+        else return static_cast<T>(u);
+    }
+
+}
+
+#endif
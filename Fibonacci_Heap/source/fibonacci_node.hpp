@@ -4,6 +4,7 @@
 #pragma once
 
 #include <iostream>
+#include <cstdint>
 #include <exception>
 #include <utility>
 
@@ -20,6 +21,7 @@ namespace algo::ds::fibo::node_impl {
         int          degree;
         bool         marked;
         bool         iterMarked = false;
+        std::uint8_t compactEpoch = 0;  // pass of the owning heap's compact() that allocated or last moved the node
 
     public:
         FiboNode()                      : value{ -1 }, prev{ nullptr }, next{ nullptr }, child{ nullptr }, parent{ nullptr }, degree{ 0 }, marked{ false } {};
@@ -0,0 +1,171 @@
+#ifndef FIBONACCIHEAP_FIBONACCI_PERSISTENT_HEAP_HPP
+#define FIBONACCIHEAP_FIBONACCI_PERSISTENT_HEAP_HPP
+
+#pragma once
+
+#include <memory>
+#include <memory_resource>
+#include <utility>
+#include <vector>
+
+namespace algo::ds::fibo {
+
+    /**
+     * Persistent min-heap: every operation returns a new version and leaves the old one untouched, both sharing all
+     * unchanged nodes. It is a leftist heap with path copying rather than a Fibonacci heap, since amortized bounds do
+     * not survive persistence (an expensive operation could be replayed on the same old version over and over), while
+     * leftist heaps give worst-case O(log n) insert, removeMinimum and meld by copying only the right spine they merge.
+     *
+     * Nodes are immutable and reference counted (allocated through Allocator with std::allocate_shared), so versions
+     * can be kept, copied in O(1) and read from several threads; a node is freed when the last version using it dies.
+     * Releasing a version frees a chain of nodes without recursion, left spines can be n nodes deep.
+     */
+    template <typename T, typename Allocator = std::allocator<T>>
+    class PersistentHeap {
+    protected:
+        struct Node;
+
+        using node_ptr = std::shared_ptr<Node>;
+
+        struct Node {
+            T        value;
+            size_t   rank;  // length of the right spine, the leftist property keeps rank(left) >= rank(right)
+            node_ptr left;
+            node_ptr right;
+
+            Node(T v, size_t r, node_ptr l, node_ptr rt) : value{ std::move(v) }, rank{ r }, left{ std::move(l) }, right{ std::move(rt) } {};
+            Node(const Node&) = delete;
+            Node& operator= (const Node&) = delete;
+            ~Node();
+        };
+
+        node_ptr  root;
+        size_t    num_elems = 0;
+        Allocator alloc;
+
+        PersistentHeap(node_ptr r, size_t n, const Allocator& a) : root{ std::move(r) }, num_elems{ n }, alloc{ a } {};
+
+    public:
+        PersistentHeap() = default;
+        explicit PersistentHeap(const Allocator& a) : alloc{ a } {};
+        PersistentHeap(const PersistentHeap&) = default;
+        PersistentHeap(PersistentHeap&& o) noexcept : root{ std::move(o.root) }, num_elems{ o.num_elems }, alloc{ o.alloc } { o.num_elems = 0; };
+
+        // Assignment adopts the version but keeps this object's allocator for new nodes, as pmr containers do.
+        PersistentHeap& operator= (const PersistentHeap& o) { root = o.root; num_elems = o.num_elems; return *this; };
+        PersistentHeap& operator= (PersistentHeap&& o) noexcept { root = std::move(o.root); num_elems = o.num_elems; o.num_elems = 0; return *this; };
+
+        [[nodiscard]] PersistentHeap insert(T value) const;
+        [[nodiscard]] PersistentHeap removeMinimum() const;
+        [[nodiscard]] PersistentHeap meld(const PersistentHeap& other) const;
+        const T&                     getMinimum() const { return root->value; };
+        [[nodiscard]] bool           isEmpty()    const { return root == nullptr; };
+        [[nodiscard]] size_t         size()       const { return num_elems; };
+        [[nodiscard]] bool           sharesRootWith(const PersistentHeap& o) const { return root == o.root; };
+        template <typename F> void   forEach(F&& f) const;
+        Allocator                    get_allocator() const { return alloc; };
+
+    private:
+        node_ptr        meld_(const node_ptr& a, const node_ptr& b) const;
+        node_ptr        make_(const T& value, const node_ptr& l, const node_ptr& r) const;
+        static size_t   rank_(const node_ptr& n) { return n ? n->rank : 0; };
+    };
+
+    /**
+     * A node only ever touches its own children, here in its destructor, which shared_ptr runs after the last release
+     * and so after every other owner's use; use_count() is never consulted. Rather than being released in place, which
+     * would recurse down a long left spine, the children are handed to a per-thread list that the outermost destructor
+     * on the stack drains. A child whose last reference goes away there is destroyed by that loop and hands over its
+     * own children in turn, so the nesting depth stays at two.
+     */
+    template<typename T, typename Allocator>
+    inline PersistentHeap<T, Allocator>::Node::~Node() {
+        thread_local std::vector<node_ptr> pending;
+        thread_local bool                  draining = false;
+
+        if (!left && !right) return;
+
+        if (left) pending.push_back(std::move(left));
+        if (right) pending.push_back(std::move(right));
+
+        if (draining) return;
+
+        draining = true;
+
+        while (!pending.empty()) {
+            node_ptr n = std::move(pending.back());  // released after pop_back, its destructor may push onto pending
+            pending.pop_back();
+        }
+
+        draining = false;
+    }
+
+    template<typename T, typename Allocator>
+    inline PersistentHeap<T, Allocator> PersistentHeap<T, Allocator>::insert(T value) const {
+        return PersistentHeap(meld_(root, make_(value, nullptr, nullptr)), num_elems + 1, alloc);
+    }
+
+    template<typename T, typename Allocator>
+    inline PersistentHeap<T, Allocator> PersistentHeap<T, Allocator>::removeMinimum() const {
+        return PersistentHeap(meld_(root->left, root->right), num_elems - 1, alloc);
+    }
+
+    template<typename T, typename Allocator>
+    inline PersistentHeap<T, Allocator> PersistentHeap<T, Allocator>::meld(const PersistentHeap& other) const {
+        return PersistentHeap(meld_(root, other.root), num_elems + other.num_elems, alloc);
+    }
+
+    /**
+     * Visits every key of this version once, in no particular order.
+     */
+    template<typename T, typename Allocator>
+    template<typename F>
+    inline void PersistentHeap<T, Allocator>::forEach(F&& f) const {
+        std::vector<const Node*> stack;
+
+        if (root) stack.push_back(root.get());
+
+        while (!stack.empty()) {
+            const Node* n = stack.back();
+            stack.pop_back();
+            f(n->value);
+
+            if (n->right) stack.push_back(n->right.get());
+            if (n->left) stack.push_back(n->left.get());
+        }
+    }
+
+    /**
+     * Merges the right spines of a and b, copying only the nodes on them. Both spines have O(log n) nodes, so the
+     * recursion depth is O(log n).
+     */
+    template<typename T, typename Allocator>
+    inline typename PersistentHeap<T, Allocator>::node_ptr PersistentHeap<T, Allocator>::meld_(const node_ptr& a, const node_ptr& b) const {
+        if (!a) return b;
+        if (!b) return a;
+
+        if (b->value < a->value) return meld_(b, a);
+
+        return make_(a->value, a->left, meld_(a->right, b));
+    }
+
+    /**
+     * New node with the children swapped if needed to keep the leftist property.
+     */
+    template<typename T, typename Allocator>
+    inline typename PersistentHeap<T, Allocator>::node_ptr PersistentHeap<T, Allocator>::make_(const T& value, const node_ptr& l, const node_ptr& r) const {
+        if (rank_(l) < rank_(r)) return std::allocate_shared<Node>(alloc, value, rank_(l) + 1, r, l);
+
+        return std::allocate_shared<Node>(alloc, value, rank_(r) + 1, l, r);
+    }
+
+}
+
+namespace algo::ds::fibo::pmr {
+
+    template <typename T>
+    using PersistentHeap = algo::ds::fibo::PersistentHeap<T, std::pmr::polymorphic_allocator<T>>;
+
+}
+
+#endif
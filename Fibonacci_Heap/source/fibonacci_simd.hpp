@@ -0,0 +1,134 @@
+#ifndef FIBONACCIHEAP_FIBONACCI_SIMD_HPP
+#define FIBONACCIHEAP_FIBONACCI_SIMD_HPP
+
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+
+#if defined(__AVX2__) || defined(__SSE4_1__)
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#endif
+
+namespace algo::ds::fibo::simd {
+
+    template <typename T>
+    inline constexpr bool has_vector_argmin = std::is_same_v<T, int> || std::is_same_v<T, float> || std::is_same_v<T, double>;
+
+    /**
+     * Index of the first smallest element of keys[0, n), n > 0. The vector overloads compute the minimum with SSE/AVX2
+     * and then locate its first occurrence, the generic version is a plain scalar scan.
+     */
+    template <typename T>
+    inline size_t argmin(const T* keys, size_t n) {
+        size_t best = 0;
+
+        for (size_t i = 1; i < n; ++i) {
+            if (keys[i] < keys[best]) best = i;
+        }
+
+        return best;
+    }
+
+    template <typename T>
+    inline size_t firstIndexOf_(const T* keys, size_t n, T value) {
+        for (size_t i = 0; i < n; ++i) {
+            if (keys[i] == value) return i;
+        }
+
+        return 0;
+    }
+
+    inline size_t argmin(const int* keys, size_t n) {
+        size_t i = 0;
+        int    m = keys[0];
+#if defined(__AVX2__)
+        if (n >= 8) {
+            __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(keys));
+
+            for (i = 8; i + 8 <= n; i += 8) v = _mm256_min_epi32(v, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(keys + i)));
+
+            __m128i h = _mm_min_epi32(_mm256_castsi256_si128(v), _mm256_extracti128_si256(v, 1));
+            h = _mm_min_epi32(h, _mm_shuffle_epi32(h, _MM_SHUFFLE(1, 0, 3, 2)));
+            h = _mm_min_epi32(h, _mm_shuffle_epi32(h, _MM_SHUFFLE(2, 3, 0, 1)));
+            m = _mm_cvtsi128_si32(h);
+        }
+#elif defined(__SSE4_1__)
+        if (n >= 4) {
+            __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(keys));
+
+            for (i = 4; i + 4 <= n; i += 4) v = _mm_min_epi32(v, _mm_loadu_si128(reinterpret_cast<const __m128i*>(keys + i)));
+
+            v = _mm_min_epi32(v, _mm_shuffle_epi32(v, _MM_SHUFFLE(1, 0, 3, 2)));
+            v = _mm_min_epi32(v, _mm_shuffle_epi32(v, _MM_SHUFFLE(2, 3, 0, 1)));
+            m = _mm_cvtsi128_si32(v);
+        }
+#endif
+        for (; i < n; ++i) m = keys[i] < m ? keys[i] : m;
+
+        return firstIndexOf_(keys, n, m);
+    }
+
+    inline size_t argmin(const float* keys, size_t n) {
+        size_t i = 0;
+        float  m = keys[0];
+#if defined(__AVX2__)
+        if (n >= 8) {
+            __m256 v = _mm256_loadu_ps(keys);
+
+            for (i = 8; i + 8 <= n; i += 8) v = _mm256_min_ps(v, _mm256_loadu_ps(keys + i));
+
+            __m128 h = _mm_min_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1));
+            h = _mm_min_ps(h, _mm_movehl_ps(h, h));
+            h = _mm_min_ss(h, _mm_shuffle_ps(h, h, 1));
+            m = _mm_cvtss_f32(h);
+        }
+#elif defined(__SSE2__) || defined(_M_X64)
+        if (n >= 4) {
+            __m128 v = _mm_loadu_ps(keys);
+
+            for (i = 4; i + 4 <= n; i += 4) v = _mm_min_ps(v, _mm_loadu_ps(keys + i));
+
+            v = _mm_min_ps(v, _mm_movehl_ps(v, v));
+            v = _mm_min_ss(v, _mm_shuffle_ps(v, v, 1));
+            m = _mm_cvtss_f32(v);
+        }
+#endif
+        for (; i < n; ++i) m = keys[i] < m ? keys[i] : m;
+
+        return firstIndexOf_(keys, n, m);
+    }
+
+    inline size_t argmin(const double* keys, size_t n) {
+        size_t i = 0;
+        double m = keys[0];
+#if defined(__AVX2__)
+        if (n >= 4) {
+            __m256d v = _mm256_loadu_pd(keys);
+
+            for (i = 4; i + 4 <= n; i += 4) v = _mm256_min_pd(v, _mm256_loadu_pd(keys + i));
+
+            __m128d h = _mm_min_pd(_mm256_castpd256_pd128(v), _mm256_extractf128_pd(v, 1));
+            h = _mm_min_sd(h, _mm_unpackhi_pd(h, h));
+            m = _mm_cvtsd_f64(h);
+        }
+#elif defined(__SSE2__) || defined(_M_X64)
+        if (n >= 2) {
+            __m128d v = _mm_loadu_pd(keys);
+
+            for (i = 2; i + 2 <= n; i += 2) v = _mm_min_pd(v, _mm_loadu_pd(keys + i));
+
+            v = _mm_min_sd(v, _mm_unpackhi_pd(v, v));
+            m = _mm_cvtsd_f64(v);
+        }
+#endif
+        for (; i < n; ++i) m = keys[i] < m ? keys[i] : m;
+
+        return firstIndexOf_(keys, n, m);
+    }
+
+}
+
+#endif
@@ -0,0 +1,276 @@
+#ifndef FIBONACCIHEAP_FIBONACCI_STATIC_HEAP_HPP
+#define FIBONACCIHEAP_FIBONACCI_STATIC_HEAP_HPP
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+namespace algo::ds::fibo {
+
+    /**
+     * Fibonacci heap with room for at most N elements stored inside the object: nodes live in a std::array, are linked
+     * by indices instead of pointers and recycled through a free list, so no operation allocates. Every operation is
+     * constexpr, so a heap can be filled and drained at compile time (e.g. to precompute a schedule).
+     *
+     * Handles are node indices, insert() returns npos instead of throwing when the heap is full. The operations follow
+     * FibonacciHeap: lazy insert, consolidation on removeMinimum, cut and cascading cut on decreaseKey and extractNode.
+     */
+    template <typename T, size_t N>
+    class StaticFibonacciHeap {
+        static_assert(N > 0, "StaticFibonacciHeap needs a capacity of at least one element");
+
+    public:
+        using handle = std::conditional_t<(N < 0xFFFF), std::uint16_t, std::conditional_t<(N < 0xFFFFFFFF), std::uint32_t, size_t>>;
+
+        static constexpr handle npos = std::numeric_limits<handle>::max();
+
+    protected:
+        struct Node {
+            T      value{};
+            handle prev = npos;
+            handle next = npos;
+            handle child = npos;
+            handle parent = npos;
+            handle degree = 0;
+            bool   marked = false;
+        };
+
+        // A node of degree k roots a tree of at least F(k+2) nodes, which bounds the degree table size.
+        static constexpr size_t maxDegree_() {
+            size_t degree = 0;
+
+            for (size_t a = 1, b = 2; b <= N; ++degree) {
+                size_t c = a + b;
+                a = b;
+                b = c;
+            }
+
+            return degree + 1;
+        }
+
+        std::array<Node, N> nodes{};
+        handle              heap = npos;
+        handle              freeList = 0;
+        size_t              num_elems = 0;
+
+    public:
+        constexpr StaticFibonacciHeap() { for (size_t i = 0; i < N; ++i) nodes[i].next = (i + 1 < N) ? handle(i + 1) : npos; };
+
+        constexpr handle                   insert(T value);
+        constexpr T                        removeMinimum();
+        constexpr void                     extractNode(handle n);
+        constexpr bool                     decreaseKey(handle n, T value);
+        constexpr void                     clear() { while (!isEmpty()) removeMinimum(); };
+        constexpr const T&                 getMinimum()         const { return nodes[heap].value; };
+        constexpr handle                   getRoot()            const { return heap; };
+        constexpr const T&                 value(handle n)      const { return nodes[n].value; };
+        [[nodiscard]] constexpr bool       isEmpty()            const { return heap == npos; };
+        [[nodiscard]] constexpr bool       isFull()             const { return freeList == npos; };
+        [[nodiscard]] constexpr size_t     size()               const { return num_elems; };
+        [[nodiscard]] static constexpr size_t capacity()              { return N; };
+
+    private:
+        constexpr handle merge_(handle a, handle b);
+        constexpr handle consolidate_(handle start);
+        constexpr void   link_(handle child, handle root);
+        constexpr void   cut_(handle n);
+        constexpr void   cascadingCut_(handle n);
+    };
+
+    template<typename T, size_t N>
+    constexpr typename StaticFibonacciHeap<T, N>::handle StaticFibonacciHeap<T, N>::insert(T value) {
+        if (freeList == npos) return npos;
+
+        handle n = freeList;
+        freeList = nodes[n].next;
+        nodes[n] = Node{ value, n, n, npos, npos, 0, false };
+        heap = merge_(heap, n);
+        num_elems++;
+
+        return n;
+    }
+
+    template<typename T, size_t N>
+    constexpr T StaticFibonacciHeap<T, N>::removeMinimum() {
+        handle m = heap;
+        T      ret = nodes[m].value;
+        handle child = nodes[m].child;
+
+        if (child != npos) {
+            handle c = child;
+
+            do {
+                nodes[c].parent = npos;
+                nodes[c].marked = false;
+                c = nodes[c].next;
+            } while (c != child);
+        }
+
+        handle roots = npos;
+
+        if (nodes[m].next != m) {
+            roots = nodes[m].next;
+            nodes[nodes[m].prev].next = roots;
+            nodes[roots].prev = nodes[m].prev;
+        }
+
+        roots = merge_(roots, child);
+        heap = (roots == npos) ? npos : consolidate_(roots);
+
+        nodes[m].next = freeList;
+        freeList = m;
+        num_elems--;
+
+        return ret;
+    }
+
+    template<typename T, size_t N>
+    constexpr void StaticFibonacciHeap<T, N>::extractNode(handle n) {
+        if (nodes[n].parent != npos) {
+            handle p = nodes[n].parent;
+            cut_(n);
+            cascadingCut_(p);
+        }
+
+        heap = n;
+        removeMinimum();
+    }
+
+    /**
+     * Returns false and leaves the heap unchanged if value is larger than the current key.
+     */
+    template<typename T, size_t N>
+    constexpr bool StaticFibonacciHeap<T, N>::decreaseKey(handle n, T value) {
+        if (nodes[n].value < value) return false;
+
+        nodes[n].value = value;
+        handle p = nodes[n].parent;
+
+        if (p != npos && value < nodes[p].value) {
+            cut_(n);
+            cascadingCut_(p);
+        }
+
+        if (value < nodes[heap].value) heap = n;
+
+        return true;
+    }
+
+    /**
+     * Splices two rings together and returns the smaller of their entry nodes.
+     */
+    template<typename T, size_t N>
+    constexpr typename StaticFibonacciHeap<T, N>::handle StaticFibonacciHeap<T, N>::merge_(handle a, handle b) {
+        if (a == npos) return b;
+        if (b == npos) return a;
+
+        handle an = nodes[a].next;
+        handle bp = nodes[b].prev;
+        nodes[a].next = b;
+        nodes[b].prev = a;
+        nodes[an].prev = bp;
+        nodes[bp].next = an;
+
+        return (nodes[b].value < nodes[a].value) ? b : a;
+    }
+
+    /**
+     * Roots are taken off the ring one by one and linked by degree, then the ring is rebuilt from the degree table.
+     */
+    template<typename T, size_t N>
+    constexpr typename StaticFibonacciHeap<T, N>::handle StaticFibonacciHeap<T, N>::consolidate_(handle start) {
+        std::array<handle, maxDegree_() + 1> table{};
+        handle                               w = start;
+
+        for (auto& t : table) t = npos;
+
+        do {
+            handle x = w;
+            handle next = nodes[w].next;
+            bool   last = (next == start);
+            nodes[x].prev = nodes[x].next = x;
+
+            while (table[nodes[x].degree] != npos) {
+                handle y = table[nodes[x].degree];
+                table[nodes[x].degree] = npos;
+
+                if (nodes[y].value < nodes[x].value) {
+                    handle t = x;
+                    x = y;
+                    y = t;
+                }
+
+                link_(y, x);
+            }
+
+            table[nodes[x].degree] = x;
+
+            if (last) break;
+
+            w = next;
+        } while (true);
+
+        handle roots = npos;
+
+        for (handle t : table) {
+            if (t != npos) roots = merge_(roots, t);
+        }
+
+        return roots;
+    }
+
+    template<typename T, size_t N>
+    constexpr void StaticFibonacciHeap<T, N>::link_(handle child, handle root) {
+        nodes[child].parent = root;
+        nodes[child].marked = false;
+
+        handle c = nodes[root].child;
+        nodes[root].child = child;
+        merge_(child, c);
+        nodes[root].degree++;
+    }
+
+    template<typename T, size_t N>
+    constexpr void StaticFibonacciHeap<T, N>::cut_(handle n) {
+        handle p = nodes[n].parent;
+
+        if (nodes[n].next == n) nodes[p].child = npos;
+        else {
+            nodes[nodes[n].prev].next = nodes[n].next;
+            nodes[nodes[n].next].prev = nodes[n].prev;
+
+            if (nodes[p].child == n) nodes[p].child = nodes[n].next;
+        }
+
+        nodes[p].degree--;
+        nodes[n].prev = nodes[n].next = n;
+        nodes[n].parent = npos;
+        nodes[n].marked = false;
+
+        handle min = heap;
+        merge_(heap, n);
+        heap = min;
+    }
+
+    template<typename T, size_t N>
+    constexpr void StaticFibonacciHeap<T, N>::cascadingCut_(handle n) {
+        while (nodes[n].parent != npos) {
+            if (!nodes[n].marked) {
+                nodes[n].marked = true;
+
+                return;
+            }
+
+            handle p = nodes[n].parent;
+            cut_(n);
+            n = p;
+        }
+    }
+
+}
+
+#endif
@@ -0,0 +1,360 @@
+#ifndef FIBONACCIHEAP_FIBONACCI_THREAD_POOL_HPP
+#define FIBONACCIHEAP_FIBONACCI_THREAD_POOL_HPP
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "fibonacci_heap.hpp"
+
+namespace algo::ds::fibo::pool {
+
+    template <typename P>
+    class PriorityThreadPool;
+
+    /**
+     * Heap node of a queued task. `owner` is the index of the worker whose heap currently holds the node and changes
+     * when the node is stolen; `generation` is bumped under the owner's lock when the task is dequeued.
+     */
+    template <typename P>
+    class TaskNode : public algo::ds::fibo::node_impl::FiboNode<P> {
+    private:
+        friend class PriorityThreadPool<P>;
+
+        std::function<void()>      fn;
+        TaskNode<P>*               nextFree = nullptr;
+        std::atomic<size_t>        owner{ 0 };
+        std::atomic<std::uint32_t> generation{ 0 };
+    };
+
+    template <typename P>
+    struct TaskHandle {
+        TaskNode<P>*  node = nullptr;
+        std::uint32_t generation = 0;
+    };
+
+    /**
+     * Thread pool where every worker owns a FibonacciHeap of tasks keyed by priority (smaller runs first). A worker
+     * pops the minimum of its own heap; the per-worker lock is only contended while a thief splits that heap or a
+     * task is reprioritized. An idle worker steals from the worker advertising the smallest minimum by splicing half
+     * of its root list (FibonacciHeap::splitRoots), which keeps execution close to global priority order without a
+     * global queue lock.
+     */
+    template <typename P = int>
+    class PriorityThreadPool {
+    public:
+        using handle = TaskHandle<P>;
+
+    protected:
+        struct alignas(64) Worker {
+            std::mutex                                    lock;
+            algo::ds::fibo::FibonacciHeap<P>              tasks;
+            std::atomic<size_t>                           count{ 0 };
+            std::atomic<P>                                minimum{ std::numeric_limits<P>::max() };
+            TaskNode<P>*                                  freeList = nullptr;
+            size_t                                        freeCount = 0;
+            std::vector<std::unique_ptr<TaskNode<P>[]>>   chunks;
+        };
+
+        std::vector<std::unique_ptr<Worker>>        workers;
+        std::vector<std::thread>                    threads;
+        std::atomic<size_t>                         pending{ 0 };
+        std::atomic<size_t>                         unfinished{ 0 };
+        std::atomic<size_t>                         nextWorker{ 0 };
+        std::atomic<size_t>                         sleepers{ 0 };
+        std::atomic<bool>                           stopping{ false };
+        std::mutex                                  sleepLock;
+        std::condition_variable                     sleepCv;
+        std::condition_variable                     idleCv;
+        std::mutex                                  sharedPoolLock;
+        TaskNode<P>*                                sharedFreeList = nullptr;
+        std::vector<std::unique_ptr<TaskNode<P>[]>> sharedChunks;
+
+        static constexpr size_t chunkSize = 1024;
+        static constexpr size_t noWorker = std::numeric_limits<size_t>::max();
+
+    public:
+        explicit PriorityThreadPool(size_t numThreads = std::thread::hardware_concurrency());
+        PriorityThreadPool(const PriorityThreadPool&) = delete;
+        PriorityThreadPool& operator= (const PriorityThreadPool&) = delete;
+        ~PriorityThreadPool();
+
+        handle               submit(P priority, std::function<void()> fn);
+        bool                 reprioritize(handle h, P priority);
+        void                 wait();
+        [[nodiscard]] size_t numWorkers() const { return workers.size(); };
+        [[nodiscard]] size_t queued()     const { return pending.load(std::memory_order_relaxed); };
+
+    private:
+        static size_t& currentIndex_()             { thread_local size_t index = noWorker; return index; };
+        static PriorityThreadPool*& currentPool_() { thread_local PriorityThreadPool* p = nullptr; return p; };
+
+        void         run_(size_t index);
+        TaskNode<P>* popLocal_(size_t index);
+        TaskNode<P>* steal_(size_t index);
+        void         publish_(Worker& w);
+        TaskNode<P>* acquire_();
+        void         release_(TaskNode<P>*);
+        size_t       refill_(TaskNode<P>*& freeList, std::vector<std::unique_ptr<TaskNode<P>[]>>& chunks);
+    };
+
+    template<typename P>
+    inline PriorityThreadPool<P>::PriorityThreadPool(size_t numThreads) {
+        if (numThreads == 0) numThreads = 1;
+
+        for (size_t i = 0; i < numThreads; ++i) workers.emplace_back(new Worker);
+        for (size_t i = 0; i < numThreads; ++i) threads.emplace_back(&PriorityThreadPool<P>::run_, this, i);
+    }
+
+    template<typename P>
+    inline PriorityThreadPool<P>::~PriorityThreadPool() {
+        wait();
+
+        {
+            std::lock_guard<std::mutex> guard(sleepLock);
+            stopping.store(true);
+        }
+
+        sleepCv.notify_all();
+
+        for (auto& t : threads) t.join();
+    }
+
+    template<typename P>
+    inline typename PriorityThreadPool<P>::handle PriorityThreadPool<P>::submit(P priority, std::function<void()> fn) {
+        size_t target = (currentPool_() == this) ? currentIndex_() : nextWorker.fetch_add(1, std::memory_order_relaxed) % workers.size();
+        auto*  n = acquire_();
+        auto&  w = *workers[target];
+        n->fn = std::move(fn);
+        n->value = priority;
+
+        unfinished.fetch_add(1, std::memory_order_relaxed);
+        pending.fetch_add(1);
+
+        std::uint32_t generation;
+        {
+            std::lock_guard<std::mutex> guard(w.lock);
+            n->owner.store(target, std::memory_order_relaxed);
+            generation = n->generation.load(std::memory_order_relaxed);
+            w.tasks.insertNode(n);
+            publish_(w);
+        }
+
+        if (sleepers.load() > 0) {
+            std::lock_guard<std::mutex> guard(sleepLock);
+            sleepCv.notify_one();
+        }
+
+        return handle{ n, generation };
+    }
+
+    /**
+     * Lowers the priority of a task that is still queued, returns false if it already started (or was never queued).
+     */
+    template<typename P>
+    inline bool PriorityThreadPool<P>::reprioritize(handle h, P priority) {
+        if (h.node == nullptr) return false;
+
+        while (true) {
+            size_t owner = h.node->owner.load(std::memory_order_acquire);
+            auto&  w = *workers[owner];
+            std::lock_guard<std::mutex> guard(w.lock);
+
+            if (h.node->owner.load(std::memory_order_relaxed) != owner) continue;
+            if (h.node->generation.load(std::memory_order_relaxed) != h.generation) return false;
+            if (h.node->value < priority) return false;
+
+            w.tasks.decreaseKey(h.node, priority);
+            publish_(w);
+
+            return true;
+        }
+    }
+
+    template<typename P>
+    inline void PriorityThreadPool<P>::wait() {
+        std::unique_lock<std::mutex> guard(sleepLock);
+        idleCv.wait(guard, [this]() { return unfinished.load(std::memory_order_acquire) == 0; });
+    }
+
+    template<typename P>
+    inline void PriorityThreadPool<P>::run_(size_t index) {
+        currentIndex_() = index;
+        currentPool_() = this;
+
+        while (true) {
+            auto* n = popLocal_(index);
+
+            if (n == nullptr) n = steal_(index);
+
+            if (n == nullptr) {
+                std::unique_lock<std::mutex> guard(sleepLock);
+                sleepers.fetch_add(1);
+                sleepCv.wait(guard, [this]() { return stopping.load() || pending.load() > 0; });
+                sleepers.fetch_sub(1);
+
+                if (stopping.load() && pending.load() == 0) return;
+
+                continue;
+            }
+
+            auto fn = std::move(n->fn);
+            n->fn = nullptr;
+            release_(n);
+            fn();
+
+            if (unfinished.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                std::lock_guard<std::mutex> guard(sleepLock);
+                idleCv.notify_all();
+            }
+        }
+    }
+
+    template<typename P>
+    inline TaskNode<P>* PriorityThreadPool<P>::popLocal_(size_t index) {
+        auto& w = *workers[index];
+
+        if (w.count.load(std::memory_order_acquire) == 0) return nullptr;
+
+        std::lock_guard<std::mutex> guard(w.lock);
+
+        if (w.tasks.isEmpty()) return nullptr;
+
+        auto* n = static_cast<TaskNode<P>*>(w.tasks.extractMinimumNode());
+        n->generation.fetch_add(1, std::memory_order_relaxed);
+        publish_(w);
+        pending.fetch_sub(1, std::memory_order_relaxed);
+
+        return n;
+    }
+
+    template<typename P>
+    inline TaskNode<P>* PriorityThreadPool<P>::steal_(size_t index) {
+        size_t victim = noWorker;
+        P      best = std::numeric_limits<P>::max();
+
+        for (size_t i = 0; i < workers.size(); ++i) {
+            if (i == index || workers[i]->count.load(std::memory_order_acquire) == 0) continue;
+
+            P m = workers[i]->minimum.load(std::memory_order_relaxed);
+
+            if (victim == noWorker || m < best) {
+                victim = i;
+                best = m;
+            }
+        }
+
+        if (victim == noWorker) return nullptr;
+
+        auto& v = *workers[victim];
+        auto& w = *workers[index];
+        std::unique_lock<std::mutex> first(index < victim ? w.lock : v.lock);
+        std::unique_lock<std::mutex> second(index < victim ? v.lock : w.lock);
+
+        if (v.tasks.isEmpty()) return nullptr;
+
+        size_t moved = v.tasks.splitRoots(w.tasks, [index](algo::ds::fibo::node_impl::FiboNode<P>* n) {
+            static_cast<TaskNode<P>*>(n)->owner.store(index, std::memory_order_relaxed);
+        });
+
+        if (moved == 0) {
+            auto* n = static_cast<TaskNode<P>*>(v.tasks.extractMinimumNode());
+            n->generation.fetch_add(1, std::memory_order_relaxed);
+            publish_(v);
+            pending.fetch_sub(1, std::memory_order_relaxed);
+
+            return n;
+        }
+
+        publish_(v);
+
+        auto* n = static_cast<TaskNode<P>*>(w.tasks.extractMinimumNode());
+        n->generation.fetch_add(1, std::memory_order_relaxed);
+        publish_(w);
+        pending.fetch_sub(1, std::memory_order_relaxed);
+
+        return n;
+    }
+
+    template<typename P>
+    inline void PriorityThreadPool<P>::publish_(Worker& w) {
+        w.count.store(w.tasks.size(), std::memory_order_release);
+        w.minimum.store(w.tasks.isEmpty() ? std::numeric_limits<P>::max() : w.tasks.getRoot()->value, std::memory_order_relaxed);
+    }
+
+    template<typename P>
+    inline TaskNode<P>* PriorityThreadPool<P>::acquire_() {
+        TaskNode<P>* n;
+
+        if (currentPool_() == this) {
+            auto& w = *workers[currentIndex_()];
+
+            if (w.freeList == nullptr) w.freeCount += refill_(w.freeList, w.chunks);
+
+            n = w.freeList;
+            w.freeList = n->nextFree;
+            w.freeCount--;
+        }
+        else {
+            std::lock_guard<std::mutex> guard(sharedPoolLock);
+
+            if (sharedFreeList == nullptr) refill_(sharedFreeList, sharedChunks);
+
+            n = sharedFreeList;
+            sharedFreeList = n->nextFree;
+        }
+
+        n->nextFree = nullptr;
+
+        return n;
+    }
+
+    /**
+     * Nodes go back to the executing worker's free list. Tasks submitted from outside the pool drain the shared list,
+     * so a worker hands a chunk worth of nodes back to it once its own list grows past two chunks.
+     */
+    template<typename P>
+    inline void PriorityThreadPool<P>::release_(TaskNode<P>* n) {
+        auto& w = *workers[currentIndex_()];
+        n->nextFree = w.freeList;
+        w.freeList = n;
+        w.freeCount++;
+
+        if (w.freeCount > 2 * chunkSize) {
+            auto* first = w.freeList;
+            auto* last = first;
+
+            for (size_t i = 1; i < chunkSize; ++i) last = last->nextFree;
+
+            w.freeList = last->nextFree;
+            w.freeCount -= chunkSize;
+
+            std::lock_guard<std::mutex> guard(sharedPoolLock);
+            last->nextFree = sharedFreeList;
+            sharedFreeList = first;
+        }
+    }
+
+    template<typename P>
+    inline size_t PriorityThreadPool<P>::refill_(TaskNode<P>*& freeList, std::vector<std::unique_ptr<TaskNode<P>[]>>& chunks) {
+        chunks.emplace_back(new TaskNode<P>[chunkSize]);
+        auto* chunk = chunks.back().get();
+
+        for (size_t i = chunkSize; i-- > 0;) {
+            chunk[i].nextFree = freeList;
+            freeList = &chunk[i];
+        }
+
+        return chunkSize;
+    }
+
+}
+
+#endif
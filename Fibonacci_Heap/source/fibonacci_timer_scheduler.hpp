@@ -0,0 +1,185 @@
+#ifndef FIBONACCIHEAP_FIBONACCI_TIMER_SCHEDULER_HPP
+#define FIBONACCIHEAP_FIBONACCI_TIMER_SCHEDULER_HPP
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <vector>
+#include "fibonacci_heap.hpp"
+
+namespace algo::ds::fibo::timers {
+
+    template <typename Clock>
+    class TimerScheduler;
+
+    /**
+     * Heap node of a timer. Nodes are owned by the scheduler's pool and recycled, the generation tells handles of
+     * fired or cancelled timers apart from the timer currently using the node.
+     */
+    template <typename Clock>
+    class TimerNode : public algo::ds::fibo::node_impl::FiboNode<typename Clock::rep> {
+    private:
+        friend class TimerScheduler<Clock>;
+
+        std::function<void()> callback;
+        TimerNode<Clock>*     nextFree = nullptr;
+        std::uint32_t         generation = 0;
+        bool                  active = false;
+    };
+
+    template <typename Clock>
+    struct TimerHandle {
+        TimerNode<Clock>* node = nullptr;
+        std::uint32_t     generation = 0;
+
+        explicit operator bool() const { return node != nullptr; };
+    };
+
+    /**
+     * Deadline timers kept in a FibonacciHeap keyed by clock ticks. schedule() and rescheduleEarlier() are O(1)
+     * amortized. cancel() does not consolidate: it cuts the node from its parent (O(1) amortized with the cascading
+     * cuts) and splices its children into the root list (O(degree), at most O(log n)), leaving the consolidation to the
+     * next extraction; only cancelling the earliest timer pays a full O(log n) amortized extract-min. runExpired()
+     * extracts all expired timers in one batch before firing them in deadline order. Timer nodes are allocated in
+     * chunks and reused, so steady-state scheduling does not allocate.
+     *
+     * Callbacks may schedule, cancel or reschedule timers, including ones from their own batch: every timer of a batch
+     * is inactive before the first callback runs, so cancel() and rescheduleEarlier() on them return false.
+     */
+    template <typename Clock = std::chrono::steady_clock>
+    class TimerScheduler {
+    public:
+        using time_point = typename Clock::time_point;
+        using handle     = TimerHandle<Clock>;
+
+    protected:
+        algo::ds::fibo::FibonacciHeap<typename Clock::rep> heap;
+        std::vector<std::unique_ptr<TimerNode<Clock>[]>>   chunks;
+        TimerNode<Clock>*                                  freeList = nullptr;
+        size_t                                             chunkSize;
+        std::vector<std::function<void()>>                 batchBuffer;
+
+    public:
+        explicit TimerScheduler(size_t chunk = 4096) : chunkSize{ chunk ? chunk : 1 } {};
+        TimerScheduler(const TimerScheduler&) = delete;
+        TimerScheduler& operator= (const TimerScheduler&) = delete;
+
+        handle                    schedule(time_point deadline, std::function<void()> callback);
+        bool                      rescheduleEarlier(handle h, time_point deadline);
+        bool                      cancel(handle h);
+        size_t                    runExpired(time_point now);
+        [[nodiscard]] bool        isActive(handle h) const { return h.node && h.node->active && h.node->generation == h.generation; };
+        [[nodiscard]] bool        isEmpty() const { return heap.isEmpty(); };
+        [[nodiscard]] size_t      size()    const { return heap.size(); };
+        std::optional<time_point> nextDeadline() const;
+
+    private:
+        TimerNode<Clock>* acquire_();
+        void              release_(TimerNode<Clock>*);
+    };
+
+    template<typename Clock>
+    inline typename TimerScheduler<Clock>::handle TimerScheduler<Clock>::schedule(time_point deadline, std::function<void()> callback) {
+        auto* n = acquire_();
+        n->value = deadline.time_since_epoch().count();
+        n->callback = std::move(callback);
+        n->active = true;
+        heap.insertNode(n);
+
+        return handle{ n, n->generation };
+    }
+
+    template<typename Clock>
+    inline bool TimerScheduler<Clock>::rescheduleEarlier(handle h, time_point deadline) {
+        if (!isActive(h)) return false;
+
+        auto ticks = deadline.time_since_epoch().count();
+
+        if (h.node->value < ticks) return false;
+
+        heap.decreaseKey(h.node, ticks);
+
+        return true;
+    }
+
+    template<typename Clock>
+    inline bool TimerScheduler<Clock>::cancel(handle h) {
+        if (!isActive(h)) return false;
+
+        heap.extractNode(h.node);
+        h.node->callback = nullptr;
+        release_(h.node);
+
+        return true;
+    }
+
+    /**
+     * Releases the whole batch first and fires it afterwards, so no callback can observe (and cancel) a timer that has
+     * already left the heap. The batch buffer is reused across calls; a nested runExpired() from a callback gets a
+     * fresh one.
+     */
+    template<typename Clock>
+    inline size_t TimerScheduler<Clock>::runExpired(time_point now) {
+        std::vector<std::function<void()>> batch;
+        batch.swap(batchBuffer);
+
+        size_t expired = heap.extractUpTo(now.time_since_epoch().count(), [this, &batch](algo::ds::fibo::node_impl::FiboNode<typename Clock::rep>* fn) {
+            auto* n = static_cast<TimerNode<Clock>*>(fn);
+            batch.push_back(std::move(n->callback));
+            n->callback = nullptr;
+            release_(n);
+        });
+
+        for (auto& callback : batch) callback();
+
+        batch.clear();
+        if (batch.capacity() > batchBuffer.capacity()) batch.swap(batchBuffer);
+
+        return expired;
+    }
+
+    /**
+     * Deadline of the earliest active timer, std::nullopt when none is scheduled.
+     */
+    template<typename Clock>
+    inline std::optional<typename TimerScheduler<Clock>::time_point> TimerScheduler<Clock>::nextDeadline() const {
+        if (heap.isEmpty()) return std::nullopt;
+
+        return time_point(typename Clock::duration(heap.getRoot()->value));
+    }
+
+    template<typename Clock>
+    inline TimerNode<Clock>* TimerScheduler<Clock>::acquire_() {
+        if (freeList == nullptr) {
+            std::unique_ptr<TimerNode<Clock>[]> owned(new TimerNode<Clock>[chunkSize]);
+            auto* chunk = owned.get();
+            chunks.push_back(std::move(owned));
+
+            for (size_t i = chunkSize; i-- > 0;) {
+                chunk[i].nextFree = freeList;
+                freeList = &chunk[i];
+            }
+        }
+
+        auto* n = freeList;
+        freeList = n->nextFree;
+        n->nextFree = nullptr;
+
+        return n;
+    }
+
+    template<typename Clock>
+    inline void TimerScheduler<Clock>::release_(TimerNode<Clock>* n) {
+        n->active = false;
+        n->generation++;
+        n->nextFree = freeList;
+        freeList = n;
+    }
+
+}
+
+#endif
@@ -0,0 +1,60 @@
+import argparse
+import random
+import time
+
+import fibonacci_heap
+import native_fibonacci_heap
+
+
+def run(module, keys, decreases):
+    heap = module.FibonacciHeap[int]()
+    start = time.perf_counter()
+    nodes = [heap.insert(k) for k in keys]
+    inserted = time.perf_counter()
+    for i, delta in decreases:
+        heap.decrease_key(nodes[i], nodes[i].key - delta)
+    decreased = time.perf_counter()
+    checksum = 0
+    while not heap.empty():
+        checksum += heap.remove_minimum()
+    end = time.perf_counter()
+
+    return inserted - start, decreased - inserted, end - decreased, checksum
+
+
+def run_batched(keys):
+    heap = native_fibonacci_heap.FibonacciHeap[int]()
+    start = time.perf_counter()
+    heap.insert_many(keys)
+    inserted = time.perf_counter()
+    checksum = sum(heap.remove_many(len(keys)))
+    end = time.perf_counter()
+
+    return inserted - start, end - inserted, checksum
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Pure-Python vs native Fibonacci heap")
+    parser.add_argument('-n', type=int, default=100000, help="number of keys")
+    args = parser.parse_args()
+
+    rng = random.Random(7)
+    keys = [rng.randrange(10 ** 9) for _ in range(args.n)]
+    decreases = [(rng.randrange(args.n), rng.randrange(1000)) for _ in range(args.n // 10)]
+
+    print("{0} inserts, {1} decrease_key, {0} remove_minimum".format(args.n, len(decreases)))
+    results = {}
+    for name, module in [('pure Python', fibonacci_heap), ('native', native_fibonacci_heap)]:
+        ins, dec, rem, checksum = run(module, keys, decreases)
+        results[name] = ins + dec + rem
+        print("{0:>12}: insert {1:.3f}s, decrease_key {2:.3f}s, remove_minimum {3:.3f}s (checksum {4})".format(
+            name, ins, dec, rem, checksum))
+    print("speedup: {0:.1f}x".format(results['pure Python'] / results['native']))
+
+    # Every ctypes call costs about a microsecond, the batched calls pay it once per batch.
+    ins, rem, checksum = run_batched(keys)
+    print("{0:>12}: insert_many {1:.3f}s, remove_many {2:.3f}s (checksum {3})".format('batched', ins, rem, checksum) + " without decrease_key")
+
+
+if __name__ == '__main__':
+    main()
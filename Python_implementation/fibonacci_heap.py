@@ -29,13 +29,13 @@ class FibonacciHeap(Generic[T]):
         if self.curr_it is not None and not self.stop:
             ret = self.curr_it.key
             if not self.__was_deletion:
-                if self.curr_it.next_ != self.__heap:
+                if self.curr_it.next_ is not self.__heap:
                     self.curr_it = self.curr_it.next_
                 else:
                     self.curr_it = None
             else:
                 self.curr_it = self.curr_it.get_next_node_for_iter()
-                if self.curr_it == self.__heap:
+                if self.curr_it is self.__heap:
                     self.stop = True
 
             return ret
@@ -163,13 +163,13 @@ class FibonacciHeap(Generic[T]):
             c.marked = False
             c.parent = None
             c = c.next_
-            if c == n:
+            if c is n:
                 break
 
     def __remove_minimum(self, n: 'FiboNode[T]') -> 'FiboNode[T]':
         self.__unmark_and_unparent_all(n.child)
 
-        if n.next_ == n:
+        if n.next_ is n:
             n = n.child
         else:
             n.next_.prev_ = n.prev_
@@ -183,9 +183,11 @@ class FibonacciHeap(Generic[T]):
         while True:
             if trees[n.degree] is not None:
                 t = trees[n.degree]
-                if t == n:
+                if t is n:
                     break
 
+                trees[n.degree] = None
+
                 if n.key < t.key:
                     t.prev_.next_ = t.next_
                     t.next_.prev_ = t.prev_
@@ -194,7 +196,7 @@ class FibonacciHeap(Generic[T]):
                     t.prev_.next_ = t.next_
                     t.next_.prev_ = t.prev_
 
-                    if n.next_ == n:
+                    if n.next_ is n:
                         t.next_ = t
                         t.prev_ = t
                         self.__add_child(t, n)
@@ -206,6 +208,8 @@ class FibonacciHeap(Generic[T]):
                         t.prev_ = n.prev_
                         self.__add_child(t, n)
                         n = t
+
+                continue
             else:
                 trees[n.degree] = n
 
@@ -217,13 +221,14 @@ class FibonacciHeap(Generic[T]):
             if n.key < min.key:
                 min = n
             n = n.next_
-            if n == stat:
+            if n is stat:
                 break
 
         return min
 
     def __cut(self, heap_: 'FiboNode[T]', n: 'FiboNode[T]') -> 'FiboNode[T]':
-        if n.next_ == n:
+        n.parent.degree -= 1
+        if n.next_ is n:
             n.parent.child = None
         else:
             n.next_.prev_ = n.prev_
@@ -272,7 +277,7 @@ class FibonacciHeap(Generic[T]):
                 return ret
             n = n.next_
 
-            if n == heap_:
+            if n is heap_:
                 break
 
         return None
@@ -301,7 +306,7 @@ class FibonacciHeap(Generic[T]):
                     print("Parent: {0}, child: {1}".format(n.key, n.child.key))
                     self.__display_childrens(c)
                     c = c.next_
-                    if c == n.child:
+                    if c is n.child:
                         break
             else:
                 print("No child")
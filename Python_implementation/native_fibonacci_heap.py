@@ -0,0 +1,248 @@
+import ctypes
+import os
+from typing import TypeVar, Generic, Iterable, List
+
+
+T = TypeVar('T')
+
+
+def _load_library() -> ctypes.CDLL:
+    names = ['libfibonacci_heap.so', 'libfibonacci_heap.dylib', 'fibonacci_heap.dll']
+    candidates = []
+    if os.environ.get('FIBONACCI_HEAP_LIB'):
+        candidates.append(os.environ['FIBONACCI_HEAP_LIB'])
+    here = os.path.dirname(os.path.abspath(__file__))
+    candidates += [os.path.join(here, name) for name in names]
+
+    for path in candidates:
+        if os.path.exists(path):
+            return ctypes.CDLL(path)
+
+    raise ImportError("native Fibonacci heap library not found, build it as described in README.md "
+                      "or point FIBONACCI_HEAP_LIB at it")
+
+
+_lib = _load_library()
+_heap_p = ctypes.c_void_p
+_node_p = ctypes.c_void_p
+_double_p = ctypes.POINTER(ctypes.c_double)
+_u64_p = ctypes.POINTER(ctypes.c_uint64)
+
+for _name, _res, _args in [
+    ('fibo_heap_abi_version', ctypes.c_uint32, []),
+    ('fibo_heap_create', _heap_p, []),
+    ('fibo_heap_destroy', None, [_heap_p]),
+    ('fibo_heap_insert', _node_p, [_heap_p, ctypes.c_double, ctypes.c_uint64]),
+    ('fibo_heap_insert_many', ctypes.c_size_t, [_heap_p, _double_p, _u64_p, ctypes.c_size_t, ctypes.POINTER(_node_p)]),
+    ('fibo_heap_peek', ctypes.c_int, [_heap_p, _double_p, _u64_p]),
+    ('fibo_heap_root', _node_p, [_heap_p]),
+    ('fibo_heap_pop', ctypes.c_int, [_heap_p, _double_p, _u64_p]),
+    ('fibo_heap_pop_many', ctypes.c_size_t, [_heap_p, _double_p, _u64_p, ctypes.c_size_t]),
+    ('fibo_heap_decrease_key', ctypes.c_int, [_heap_p, _node_p, ctypes.c_double]),
+    ('fibo_heap_erase', None, [_heap_p, _node_p]),
+    ('fibo_heap_find', _node_p, [_heap_p, ctypes.c_double]),
+    ('fibo_heap_merge', None, [_heap_p, _heap_p]),
+    ('fibo_heap_clear', None, [_heap_p]),
+    ('fibo_heap_size', ctypes.c_size_t, [_heap_p]),
+    ('fibo_heap_max', ctypes.c_double, [_heap_p]),
+    ('fibo_heap_keys', ctypes.c_size_t, [_heap_p, _double_p, ctypes.c_size_t]),
+    ('fibo_handle_key', ctypes.c_double, [_node_p]),
+    ('fibo_handle_payload', ctypes.c_uint64, [_node_p]),
+]:
+    _fn = getattr(_lib, _name)
+    _fn.restype = _res
+    _fn.argtypes = _args
+
+_insert = _lib.fibo_heap_insert
+_pop = _lib.fibo_heap_pop
+
+if _lib.fibo_heap_abi_version() != 1:
+    raise ImportError("unsupported native Fibonacci heap ABI version {0}".format(_lib.fibo_heap_abi_version()))
+
+
+class NativeNode(object):
+    """Handle of an element of the native heap, valid until the element is removed."""
+
+    __slots__ = ('_handle', '_as_int')
+
+    def __init__(self, handle: int, as_int: bool):
+        self._handle = handle
+        self._as_int = as_int
+
+    @property
+    def key(self):
+        k = _lib.fibo_handle_key(self._handle)
+        return int(k) if self._as_int else k
+
+    @property
+    def payload(self) -> int:
+        return _lib.fibo_handle_payload(self._handle)
+
+    def __bool__(self):
+        return True
+
+    def __str__(self) -> str:
+        return "Key: {0}".format(self.key)
+
+
+class FibonacciHeap(Generic[T]):
+    """
+    Drop-in replacement for fibonacci_heap.FibonacciHeap backed by the C ABI library (Fibonacci_Heap/capi).
+    Keys are stored as doubles; a heap that only ever saw int keys returns ints, so exact for |key| < 2**53.
+    Every method is a ctypes call of about a microsecond, so prefer insert_many and remove_many where possible.
+    """
+
+    def __init__(self, heap=None):
+        self.__heap = _lib.fibo_heap_create()
+        if not self.__heap:
+            raise MemoryError
+        self.__ints = True
+        self.__out = ctypes.c_double()
+        self.__out_p = ctypes.pointer(self.__out)
+        if heap is not None:
+            self.insert(heap.key)
+
+    def __del__(self):
+        if getattr(self, '_FibonacciHeap__heap', None):
+            _lib.fibo_heap_destroy(self.__heap)
+            self.__heap = None
+
+    def __key(self, value: float):
+        return int(value) if self.__ints else value
+
+    def __keys(self) -> List:
+        n = self.size()
+        buffer = (ctypes.c_double * n)()
+        _lib.fibo_heap_keys(self.__heap, buffer, n)
+        return [self.__key(k) for k in buffer]
+
+    # Magic methods
+    def __str__(self) -> str:
+        ret = "Heap (min key): {0}, all nodes:\n".format(self.get_minimum())
+        for i_ in self:
+            ret += str(i_)
+
+        return ret
+
+    def __iter__(self):
+        return iter(self.__keys())
+
+    def __eq__(self, other: 'FibonacciHeap[T]') -> bool:
+        return len(self) == len(other) and self.__keys() == other.__keys()
+
+    def __ne__(self, other: 'FibonacciHeap[T]') -> bool:
+        return not self == other
+
+    def __lt__(self, other: 'FibonacciHeap[T]') -> bool:
+        if len(self) > len(other) or self.empty() or other.empty() or self.get_minimum() >= other.get_minimum():
+            return False
+        return all(a < b for a, b in zip(self.__keys(), other.__keys()))
+
+    def __le__(self, other: 'FibonacciHeap[T]') -> bool:
+        return not self > other
+
+    def __gt__(self, other: 'FibonacciHeap[T]') -> bool:
+        if len(self) < len(other) or self.empty() or other.empty() or self.get_minimum() <= other.get_minimum():
+            return False
+        return all(a > b for a, b in zip(self.__keys(), other.__keys()))
+
+    def __ge__(self, other: 'FibonacciHeap[T]') -> bool:
+        return not self < other
+
+    def __len__(self) -> int:
+        return _lib.fibo_heap_size(self.__heap)
+
+    # Public methods
+    def empty(self) -> bool:
+        return len(self) == 0
+
+    def insert(self, value: T, payload: int = 0) -> NativeNode:
+        if not isinstance(value, int):
+            self.__ints = False
+        handle = _insert(self.__heap, value, payload)
+        if not handle:
+            raise MemoryError
+
+        return NativeNode(handle, self.__ints)
+
+    def insert_many(self, values: Iterable[T]) -> int:
+        """Inserts all values with a single native call, returns the number inserted."""
+        values = list(values)
+        if not all(isinstance(v, int) for v in values):
+            self.__ints = False
+        keys = (ctypes.c_double * len(values))(*values)
+        inserted = _lib.fibo_heap_insert_many(self.__heap, keys, None, len(values), None)
+        if inserted != len(values):
+            raise MemoryError
+
+        return inserted
+
+    def merge(self, other: 'FibonacciHeap[T]'):
+        self.__ints = self.__ints and other.__ints
+        _lib.fibo_heap_merge(self.__heap, other.__heap)
+
+    def remove_minimum(self) -> T:
+        status = _pop(self.__heap, self.__out_p, None)
+
+        if status < 0:
+            raise MemoryError
+        if not status:
+            raise IndexError("remove_minimum from an empty heap")
+
+        return int(self.__out.value) if self.__ints else self.__out.value
+
+    def remove_many(self, count: int) -> List:
+        """Pops up to count minima in ascending order with a single native call."""
+        keys = (ctypes.c_double * count)()
+        popped = _lib.fibo_heap_pop_many(self.__heap, keys, None, count)
+        return [self.__key(k) for k in keys[:popped]]
+
+    def display_heap(self):
+        if self.empty():
+            print("Heap is empty")
+        else:
+            print("Minimum: {0}".format(self.get_minimum()))
+            for k in self:
+                print("Key: {0}".format(k))
+
+    def decrease_key(self, n: NativeNode, value: T):
+        if not isinstance(value, int):
+            self.__ints = False
+        if _lib.fibo_heap_decrease_key(self.__heap, n._handle, value) < 0:
+            raise MemoryError
+
+    def find(self, value: T) -> bool:
+        return bool(_lib.fibo_heap_find(self.__heap, value))
+
+    def get_minimum(self) -> T:
+        if not _lib.fibo_heap_peek(self.__heap, self.__out_p, None):
+            raise IndexError("get_minimum of an empty heap")
+
+        return self.__key(self.__out.value)
+
+    def get_root(self) -> NativeNode or None:
+        handle = _lib.fibo_heap_root(self.__heap)
+        return NativeNode(handle, self.__ints) if handle else None
+
+    def size(self):
+        return len(self)
+
+    def get_max(self) -> T:
+        return self.__key(_lib.fibo_heap_max(self.__heap))
+
+    def clear(self):
+        _lib.fibo_heap_clear(self.__heap)
+        self.__ints = True
+
+
+if __name__ == '__main__':
+    f = FibonacciHeap[int]()
+    f.insert(0)
+    f.insert(1)
+    f.insert(2)
+    f.insert(3)
+    f.insert(4)
+    f.display_heap()
+    f.remove_minimum()
+    for i in f:
+        print(i)